@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Converts a form file (as saved by the Gui Builder) or a theme file to the binary format.
+// Container::loadWidgetsFromFile and the DefaultThemeLoader recognize binary files automatically,
+// so the output file can be used as a drop-in replacement for the original text file.
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Global.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input file> <output file>" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory(argv[1], fileSize);
+        if (!fileContents)
+        {
+            std::cerr << "Failed to open '" << argv[1] << "'" << std::endl;
+            return 1;
+        }
+
+        const auto rootNode = tgui::DataIO::parse(tgui::CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
+
+        std::stringstream outputStream;
+        tgui::DataIO::emitBinary(rootNode, outputStream);
+        // The file is opened in binary mode, tgui::writeFile would translate line endings on Windows
+        std::ofstream outputFile{argv[2], std::ios::binary};
+        const std::string outputData = outputStream.str();
+        if (!outputFile.write(outputData.data(), static_cast<std::streamsize>(outputData.size())))
+        {
+            std::cerr << "Failed to write '" << argv[2] << "'" << std::endl;
+            return 1;
+        }
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << "Failed to convert '" << argv[1] << "': " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -493,9 +493,7 @@ bool GuiBuilder::loadGuiBuilderState()
     if (!fileContents)
         return false;
 
-    /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-    std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-    const auto node = tgui::DataIO::parse(stream);
+    const auto node = tgui::DataIO::parse(tgui::CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
     if (node->propertyValuePairs["RecentFiles"])
     {
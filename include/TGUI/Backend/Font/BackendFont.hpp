@@ -31,8 +31,11 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#include <TGUI/TextStyle.hpp>
+
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +49,13 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /// Character size at which glyphs are rasterized when the distance field mode is enabled
+        static constexpr unsigned int DistanceFieldReferenceSize = 48;
+
+        /// Distance (in pixels at the reference size) from the edge of the glyph that is stored in a distance field texture.
+        /// The alpha channel contains 0.5 on the edge, 1 at this distance inside the glyph and 0 at this distance outside it.
+        static constexpr unsigned int DistanceFieldSpread = 6;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +278,90 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields instead of as bitmaps
+        ///
+        /// @param enabled  Should each glyph be rasterized only once, at a reference size, and be scaled when rendering?
+        ///
+        /// In distance field mode, the alpha channel of the font texture contains the distance to the edge of the glyph
+        /// instead of its coverage. This allows a single glyph to be rendered at any character size and outline thickness,
+        /// but it requires a render target that draws the text with a distance field shader (the OpenGL3 and GLES2 ones).
+        /// The default implementation doesn't support this mode and ignores the call.
+        ///
+        /// Outlines are limited to the distance that is stored around each glyph, thicker outlines are drawn with the thickness
+        /// returned by getDistanceFieldMaxOutlineThickness.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setDistanceFieldEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields instead of as bitmaps
+        ///
+        /// @return Is each glyph only rasterized once, at a reference size, and scaled when rendering?
+        ///
+        /// @see setDistanceFieldEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the thickest outline that can be drawn around glyphs when the distance field mode is enabled
+        ///
+        /// @param characterSize  Character size of the text
+        ///
+        /// @return Maximum outline thickness, which is DistanceFieldSpread pixels at the reference size scaled to the character size
+        ///
+        /// @see setDistanceFieldEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static float getDistanceFieldMaxOutlineThickness(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs in advance, so that text using them can be shown without having to rasterize them first
+        ///
+        /// @param characters      Characters for which the glyphs should be loaded
+        /// @param characterSizes  Character sizes at which the glyphs should be loaded
+        /// @param style           Style of the text (only the bold style affects the glyphs)
+        ///
+        /// The default implementation loads the glyphs immediately. Backends may load them on a background thread instead,
+        /// in which case the glyphs are added to the font texture when the font is used after they have been loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void preload(const String& characters, const std::vector<unsigned int>& characterSizes, TextStyles style = TextStyle::Regular);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs that were requested with the preload function are still being loaded in the background
+        ///
+        /// @return Is a background thread still loading glyphs?
+        ///
+        /// @see preload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isPreloading() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the directory in which preloaded glyphs are stored, so that they don't have to be rasterized again
+        ///
+        /// @param directory  Existing directory in which cache files are stored, or an empty string to not cache glyphs on disk
+        ///
+        /// The cache files are named after a hash of the font file, so the same directory can be shared between fonts.
+        /// This directory is only used by backends that load preloaded glyphs in the background. No directory is set by default.
+        ///
+        /// @see preload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlyphCacheDirectory(const String& directory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the directory in which preloaded glyphs are stored
+        ///
+        /// @return Directory in which cache files are stored, or an empty string if glyphs aren't cached on disk
+        ///
+        /// @see setGlyphCacheDirectory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const String& getGlyphCacheDirectory() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Sets the scale at which to render each glyph, to allow rendering text at a higher resolution
@@ -308,7 +402,9 @@ TGUI_MODULE_EXPORT namespace tgui
     protected:
 
         bool m_isSmooth = true;
+        bool m_distanceFieldEnabled = false;
         float m_fontScale = 1;
+        String m_glyphCacheDirectory;
     };
 }
 
@@ -33,6 +33,11 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
+    #include <atomic>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -214,6 +219,38 @@ TGUI_MODULE_EXPORT namespace tgui
         void setSmooth(bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields instead of as bitmaps
+        ///
+        /// @param enabled  Should each glyph be rasterized only once, at a reference size, and be scaled when rendering?
+        ///
+        /// Changing this setting discards all glyphs that were already loaded. Bitmap fonts don't support this mode.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs in advance on a background thread
+        ///
+        /// @param characters      Characters for which the glyphs should be loaded
+        /// @param characterSizes  Character sizes at which the glyphs should be loaded
+        /// @param style           Style of the text (only the bold style affects the glyphs)
+        ///
+        /// The glyphs are rasterized with a separate freetype face, so this function returns immediately. Loaded glyphs are
+        /// added to the font texture when the font is used again, i.e. when text is updated or drawn during the next frame.
+        /// If a glyph cache directory was set then glyphs are read from and written to a cache file in that directory.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const String& characters, const std::vector<unsigned int>& characterSizes, TextStyles style = TextStyle::Regular) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs that were requested with the preload function are still being loaded in the background
+        ///
+        /// @return Is the background thread still loading glyphs?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPreloading() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Sets the scale at which to render each glyph, to allow rendering text at a higher resolution
@@ -236,11 +273,67 @@ TGUI_MODULE_EXPORT namespace tgui
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
         };
 
+        struct RasterizedGlyph
+        {
+            std::uint64_t key = 0;            //!< Key under which the glyph is stored in m_glyphs
+            Glyph         glyph;              //!< Glyph information, its texture rect isn't set until it is added to the texture
+            unsigned int  imageWidth = 0;     //!< Width of the image, including the padding on both sides
+            unsigned int  imageHeight = 0;    //!< Height of the image, including the padding on both sides
+            unsigned int  padding = 0;        //!< Amount of pixels around the glyph inside the image
+            std::vector<std::uint8_t> alpha;  //!< Alpha channel of the glyph image
+        };
+
+        struct PreloadRequest
+        {
+            std::u32string            characters;
+            std::vector<unsigned int> pixelSizes;
+            bool                      bold = false;
+            bool                      distanceField = false;
+            unsigned int              glyphGeneration = 0;
+            String                    cacheDirectory;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Loads a glyph with freetype
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes a glyph into an image that includes padding. The face must already have the correct pixel size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker stroker, char32_t codePoint, bool bold,
+                                   float outlineThickness, bool distanceField, RasterizedGlyph& rasterizedGlyph);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the image of a rasterized glyph into the texture and returns the glyph with its texture rect
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph addGlyphToTexture(const RasterizedGlyph& rasterizedGlyph);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the glyphs that were loaded by the preload thread to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void publishPreloadedGlyphs();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes the glyphs from the preload requests with its own freetype face, until all requests are handled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void runPreloadThread();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Aborts the preload thread and waits for it to finish
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopPreloading();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads the glyphs from a cache file. Returns false if the file doesn't exist or is invalid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool readGlyphCache(const Filesystem::Path& filename, std::unordered_map<std::uint64_t, RasterizedGlyph>& glyphs);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Writes the glyphs to a cache file. Returns false if the file couldn't be written or would be too large to be read.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool writeGlyphCache(const Filesystem::Path& filename, const std::unordered_map<std::uint64_t, RasterizedGlyph>& glyphs);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns a cached glyph or calls loadGlyph to load it when this is the first time the glyph is requested
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -256,6 +349,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool setCurrentSize(unsigned int characterSize);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the size in pixels on which the freetype operations are performed, without applying the font scale
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setCurrentPixelSize(unsigned int pixelSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all loaded glyphs and resets the texture to only contain the pixels for underlining
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetGlyphs();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Destroys freetype resources
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,10 +390,21 @@ TGUI_MODULE_EXPORT namespace tgui
         std::vector<Row> m_rows;
 
         std::unique_ptr<std::uint8_t[]> m_fileContents;
+        std::size_t m_fileSize = 0;
         std::unique_ptr<std::uint8_t[]> m_pixels;
         std::shared_ptr<BackendTexture> m_texture;
         unsigned int m_textureSize = 0;
         unsigned int m_textureVersion = 0;
+
+        // Glyphs can be loaded on a background thread. Only m_fileContents is shared with that thread, the other members below
+        // m_preloadMutex are protected by the mutex. The glyph generation changes when all glyphs are removed from the texture.
+        std::thread m_preloadThread;
+        mutable std::mutex m_preloadMutex;
+        std::deque<PreloadRequest> m_preloadRequests;
+        std::vector<RasterizedGlyph> m_preloadedGlyphs;
+        bool m_preloadThreadRunning = false;
+        unsigned int m_glyphGeneration = 0;
+        std::atomic<bool> m_preloadCancelled{false};
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
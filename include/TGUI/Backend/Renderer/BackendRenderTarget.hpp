@@ -33,6 +33,12 @@
 #include <TGUI/Outline.hpp>
 #include <TGUI/RenderStates.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <list>
+    #include <map>
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -207,6 +213,49 @@ TGUI_MODULE_EXPORT namespace tgui
                                      const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redirects all following draw calls to an offscreen texture, until endLayer is called
+        ///
+        /// @param states        Render states with which the layer will be drawn, the texture is large enough for their scaling
+        /// @param layerTexture  Texture to render to. A new texture is created when it is a nullptr or when its size is wrong.
+        /// @param size          Size of the layer, in the coordinate system of the widgets
+        ///
+        /// @return True if the layer was started, false if the render target doesn't support rendering to textures.
+        ///         The endLayer function must only be called when this function returned true.
+        ///
+        /// This is used by containers that are cached as a layer. The default implementation always returns false.
+        /// @see Container::setCachedAsLayer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool beginLayer(const RenderStates& states, std::shared_ptr<BackendTexture>& layerTexture, Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops rendering to the texture that was passed to beginLayer and restores the previous render state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void endLayer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the contents of a layer that was previously rendered between beginLayer and endLayer
+        ///
+        /// @param states        Render states to use for drawing
+        /// @param layerTexture  Texture that was passed to beginLayer
+        /// @param size          Size of the layer, in the coordinate system of the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawLayer(const RenderStates& states, const std::shared_ptr<BackendTexture>& layerTexture, Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the texture needed to draw a layer without losing detail
+        ///
+        /// @param states  Render states with which the layer will be drawn
+        /// @param size    Size of the layer, in the coordinate system of the widgets
+        ///
+        /// @return Amount of pixels that the layer covers, which takes both the view and the scaling of the transform into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2u getLayerPixelSize(const RenderStates& states, Vector2f size) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -221,6 +270,69 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void updateClipping(FloatRect clipRect, FloatRect clipViewport) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the points on a circle with radius 1 around the origin, starting at angle 0
+        ///
+        /// @param nrPoints  Amount of points on the circle
+        ///
+        /// The points aren't cached, they are only needed to create a shape that isn't in the cache of shapes yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<Vector2f> getUnitCirclePoints(unsigned int nrPoints);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how many pixels of a layer correspond to one unit in the coordinate system of the widgets inside it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2f getLayerPixelsPerPoint(const RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether each pixel of the layer texture ends up on exactly one pixel of the render target.
+        // Layers that are rotated or that don't cover a whole number of pixels need linear filtering to not look jagged.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isLayerDrawnOneToOne(const RenderStates& states, const BackendTexture& layerTexture, Vector2f size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Triangles that make up a circle or rounded rectangle, including its borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ShapeGeometry
+        {
+            std::vector<Vertex> vertices;
+            std::vector<unsigned int> indices;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parameters that uniquely define the geometry of a circle or rounded rectangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ShapeGeometryKey
+        {
+            bool circle;
+            Vector2f size;
+            float radius;
+            float borderThickness;
+            Color backgroundColor;
+            Color borderColor;
+
+            TGUI_NODISCARD bool operator<(const ShapeGeometryKey& other) const;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the cached geometry for the key and marks it as most recently used, or returns a nullptr when not cached
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const ShapeGeometry* findShapeGeometry(const ShapeGeometryKey& key);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the geometry to the cache, removing the least recently used shape if the cache contains too many shapes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const ShapeGeometry& addShapeGeometry(const ShapeGeometryKey& key, ShapeGeometry&& geometry);
+
+
+        static constexpr std::size_t MaxCachedShapeGeometries = 256;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -230,6 +342,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
         Vector2f m_pixelsPerPoint = {1, 1};
+
+        std::list<std::pair<ShapeGeometryKey, ShapeGeometry>> m_shapeGeometries; // Most recently used shape comes first
+        std::map<ShapeGeometryKey, std::list<std::pair<ShapeGeometryKey, ShapeGeometry>>::iterator> m_shapeGeometryCache;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
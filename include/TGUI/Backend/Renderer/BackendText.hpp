@@ -181,10 +181,11 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Helper function used by updateVertices to add vertices for a glyph
+        // Helper function used by updateVertices to add vertices for a glyph.
+        // The quad is made larger than the glyph by the padding, given in texture pixels and in text coordinates.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color,
-                          const FontGlyph& glyph, float fontScale, float italicShear);
+                          const FontGlyph& glyph, float texturePadding, float positionPadding, float italicShear);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
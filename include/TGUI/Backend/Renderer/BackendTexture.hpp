@@ -27,6 +27,7 @@
 #define TGUI_BACKEND_TEXTURE_HPP
 
 #include <TGUI/Font.hpp>
+#include <TGUI/Rect.hpp>
 #include <TGUI/String.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
@@ -44,18 +45,49 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines which pixel data the load function keeps in memory after uploading the pixels to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class PixelStorage
+        {
+            AlphaMask, //!< Only keep 1 bit per pixel that indicates whether the pixel is transparent
+            Full       //!< Keep a copy of all pixels, which is needed to access them with getPixels (default)
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual ~BackendTexture() = default;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes which pixel data the load function keeps in memory for this texture
+        ///
+        /// @param storage  What to keep after the next call to load
+        ///
+        /// By default, the value passed to setDefaultPixelStorage is used (which is PixelStorage::Full by default).
+        /// The alpha mask is enough for isTransparentPixel and uses 32 times less memory, but getPixels will return nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPixelStorage(PixelStorage storage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns which pixel data the load function keeps in memory for this texture
+        ///
+        /// @return What is kept after calling load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD PixelStorage getPixelStorage() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the texture from an array of 32-bits RGBA pixels
         ///
         /// @param size   Width and height of the image to create
         /// @param pixels Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
         /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// Depending on getPixelStorage(), either the pixels or only an alpha mask created from them is kept after the upload.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth);
 
@@ -72,6 +104,19 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture
+        ///
+        /// @param rect   Part of the texture to change, which has to lie completely inside the texture
+        /// @param pixels Pointer to array of rect.width*rect.height*4 bytes with RGBA pixels
+        ///
+        /// The pixels or alpha mask that are kept in memory (see setPixelStorage) are updated as well.
+        ///
+        /// @return False if the rectangle didn't fit inside the texture, true when the pixels were updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updatePixels(const UIntRect& rect, const std::uint8_t* pixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -109,16 +154,63 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Returns a pointer to the pixels (read-only)
         ///
         /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, or nullptr if the pixel data isn't stored.
+        ///
+        /// The pixels are only stored when the texture was loaded with the load function while the pixel storage was set to
+        /// PixelStorage::Full.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD const std::uint8_t* getPixels() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes which pixel data the load function keeps in memory for textures that are created afterwards
+        ///
+        /// @param storage  What to keep for new textures
+        ///
+        /// Setting this to PixelStorage::AlphaMask reduces the memory used by textures that are loaded from a file afterwards.
+        /// Textures that are loaded from memory or from pixel data always keep their pixels, as they are needed to save the
+        /// texture when a widget is saved to a file.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDefaultPixelStorage(PixelStorage storage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns which pixel data the load function keeps in memory for new textures
+        ///
+        /// @return What is kept for new textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static PixelStorage getDefaultPixelStorage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the alpha value below which isTransparentPixel considers pixels of this texture to be transparent
+        ///
+        /// @param threshold  Pixels with an alpha value that is less than or equal to this value are transparent (default 0)
+        ///
+        /// When only an alpha mask is kept, the mask is created when the texture is loaded. The threshold thus has to be set
+        /// before calling load in that case.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAlphaMaskThreshold(std::uint8_t threshold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the alpha value below which isTransparentPixel considers pixels of this texture to be transparent
+        ///
+        /// @return Highest alpha value for which a pixel is still considered transparent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint8_t getAlphaMaskThreshold() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
+        std::unique_ptr<std::uint8_t[]> m_transparencyMask; // 1 bit per pixel (row by row), bit is set for transparent pixels
+        PixelStorage m_pixelStorage = m_defaultPixelStorage;
+        std::uint8_t m_alphaMaskThreshold = 0;
         bool m_isSmooth = true;
+
+        static PixelStorage m_defaultPixelStorage;
     };
 }
 
@@ -32,6 +32,10 @@
     #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -102,6 +106,113 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws some text
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param text    Text to draw
+        ///
+        /// Text that uses a font in distance field mode is drawn with a shader that reconstructs the glyph edges.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(const RenderStates& states, const Text& text) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a circle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Diameter of the circle
+        /// @param backgroundColor  Color to fill the circle with
+        /// @param borderThickness  Thickness of the border to draw around the circle (outside given size if thickness is positive)
+        /// @param borderColor      Color of the border, if borderThickness differs from 0
+        ///
+        /// When SDF shapes are enabled, the circle is drawn as a single quad.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness = 0, const Color& borderColor = {}) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a rounded rectangle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Size of the rectangle (includes borders)
+        /// @param backgroundColor  Fill color of the rectangle
+        /// @param radius           Radius of the rounded corners
+        /// @param borders          Optional borders on the sides of the rectangle (must be the same on all sides)
+        /// @param borderColor      Color of the borders
+        ///
+        /// When SDF shapes are enabled, the rectangle is drawn as a single quad.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor, float radius,
+                                  const Borders& borders = {0}, const Color& borderColor = Color::Black) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether circles and rounded rectangles are drawn with a signed distance field shader
+        ///
+        /// @param enabled  Should rounded shapes be drawn as a single quad instead of being split into triangles?
+        ///
+        /// The shader calculates the distance to the edge of the shape for each pixel, so only 4 vertices are needed per shape
+        /// no matter how large the radius is, and the edges of the shapes are anti-aliased. SDF shapes are disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSdfShapesEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether circles and rounded rectangles are drawn with a signed distance field shader
+        ///
+        /// @return Are rounded shapes drawn as a single quad instead of being split into triangles?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSdfShapesEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether vertices are converted to a more compact format before they are uploaded to the GPU
+        ///
+        /// @param packed  Should texture coordinates be uploaded as normalized 16-bit integers instead of floats?
+        ///
+        /// Packed vertices take 16 bytes instead of 20 bytes, at the cost of converting them on the CPU before each draw call.
+        /// This can be faster on devices where memory bandwidth is the bottleneck. Packing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPackedVerticesEnabled(bool packed);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether vertices are converted to a more compact format before they are uploaded to the GPU
+        ///
+        /// @return Are texture coordinates uploaded as normalized 16-bit integers instead of floats?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPackedVerticesEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redirects all following draw calls to an offscreen texture, until endLayer is called
+        ///
+        /// @param states        Render states with which the layer will be drawn, the texture is large enough for their scaling
+        /// @param layerTexture  Texture to render to. A new texture is created when it is a nullptr or when its size is wrong.
+        /// @param size          Size of the layer, in the coordinate system of the widgets
+        ///
+        /// @return True if the layer was started, false if the framebuffer couldn't be created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool beginLayer(const RenderStates& states, std::shared_ptr<BackendTexture>& layerTexture, Vector2f size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops rendering to the texture that was passed to beginLayer and restores the previous render state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endLayer() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the contents of a layer that was previously rendered between beginLayer and endLayer
+        ///
+        /// @param states        Render states to use for drawing
+        /// @param layerTexture  Texture that was passed to beginLayer
+        /// @param size          Size of the layer, in the coordinate system of the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawLayer(const RenderStates& states, const std::shared_ptr<BackendTexture>& layerTexture, Vector2f size) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -118,12 +229,38 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Calls glEnableVertexAttribArray and glVertexAttribPointer.
+        // Calls glEnableVertexAttribArray and glVertexAttribPointer for the vertex format that is currently selected.
         // Called only once when using a VAO (GLES 3.x), but on every draw when using GLES 2.0
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setVertexAttribs();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture, or the empty texture when drawing without a texture, if it isn't bound yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindTexture(const std::shared_ptr<BackendTexture>& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the vertices into the vertex buffer, converting them to packed vertices first if needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uploadVertices(const Vertex* vertices, std::size_t vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws a rounded rectangle as a single quad with the SDF shader. The border thickness is measured inwards from the edge.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSdfShape(const RenderStates& states, Vector2f position, Vector2f size, float radius,
+                          float borderThickness, const Color& backgroundColor, const Color& borderColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the blend function for drawing into the framebuffer that is currently bound.
+        // Inside a layer the alpha channel is accumulated separately so that the texture contains premultiplied colors.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetBlendFunc();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Creates the vertex and index buffers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,6 +285,39 @@ TGUI_MODULE_EXPORT namespace tgui
         unsigned int m_positionShaderLocation = 0;
         unsigned int m_colorShaderLocation = 1;
         unsigned int m_texCoordShaderLocation = 2;
+
+        bool m_packedVerticesEnabled = false;
+        bool m_packedVertexAttribsSet = false; // Which format was used the last time setVertexAttribs was called
+        std::vector<PackedVertex> m_packedVertices;
+
+        bool m_sdfShapesEnabled = false;
+        unsigned int m_sdfShaderProgram = 0;
+        int m_sdfProjectionMatrixLocation = -1;
+        int m_sdfShapeCenterLocation = -1;
+        int m_sdfHalfSizeLocation = -1;
+        int m_sdfRadiusLocation = -1;
+        int m_sdfBorderThicknessLocation = -1;
+        int m_sdfBorderColorLocation = -1;
+        int m_sdfPixelSizeLocation = -1;
+
+        unsigned int m_textShaderProgram = 0;
+        int m_textProjectionMatrixLocation = -1;
+        int m_textThresholdLocation = -1;
+        int m_textSmoothingLocation = -1;
+
+        // State of the render target that needs to be restored when a layer ends
+        struct LayerState
+        {
+            FloatRect viewRect;
+            FloatRect viewport;
+            Vector2f targetSize;
+            std::vector<std::pair<FloatRect, FloatRect>> clipLayers;
+            Vector2f pixelsPerPoint;
+            Transform projectionTransform;
+            int oldFramebuffer = 0;
+            unsigned int framebuffer = 0;
+        };
+        std::vector<LayerState> m_layers;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
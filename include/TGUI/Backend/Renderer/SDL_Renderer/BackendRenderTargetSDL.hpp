@@ -32,6 +32,10 @@
     #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -108,11 +112,26 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the vertices that were collected by drawVertexArray to SDL_RenderGeometry
+        ///
+        /// Consecutive draw calls that use the same texture are merged while drawing the gui. This function has to be called
+        /// before anything changes the state of the SDL renderer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         SDL_Renderer* m_renderer = nullptr;
         Transform m_projectionTransform;
+
+        // Transformed vertices of draw calls that haven't been passed to SDL yet. The memory is reused between frames.
+        std::vector<Vertex> m_batchVertices;
+        std::vector<int> m_batchIndices;
+        std::shared_ptr<BackendTexture> m_batchTexture;
+        bool m_batchingEnabled = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,17 @@ TGUI_MODULE_EXPORT namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture
+        ///
+        /// @param rect   Part of the texture to change, which has to lie completely inside the texture
+        /// @param pixels Pointer to array of rect.width*rect.height*4 bytes with RGBA pixels
+        ///
+        /// @return False if the rectangle didn't fit inside the texture, true when the pixels were updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updatePixels(const UIntRect& rect, const std::uint8_t* pixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
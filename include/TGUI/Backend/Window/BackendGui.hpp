@@ -33,7 +33,13 @@
 #include <TGUI/TwoFingerScrollDetect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <condition_variable>
+    #include <functional>
+    #include <cstdint>
     #include <chrono>
+    #include <atomic>
+    #include <mutex>
+    #include <vector>
     #include <stack>
 #endif
 
@@ -153,10 +159,62 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return Has the event been consumed?
         ///         When this function returns false, then the event was ignored by all widgets.
+        ///
+        /// When mouse move coalescing is enabled, MouseMoved events are only stored and this function returns false for them.
+        /// @see setMouseMoveCoalescingEnabled
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive mouse move events are merged into a single event per frame
+        ///
+        /// @param enabled  Should mouse move events be coalesced?
+        ///
+        /// Mice with a high polling rate and touch screens can deliver several mouse move events per frame. When this option
+        /// is enabled, handleEvent only stores the position of a MouseMoved event. The widgets receive a single mouse move event
+        /// for the last position when a different event is handled, when processCoalescedMouseMoves() is called or when the
+        /// time is updated (which happens in draw() and once per frame in mainLoop()).
+        /// The positions of the merged events remain available via getCoalescedMousePositions().
+        ///
+        /// Mouse move coalescing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseMoveCoalescingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive mouse move events are merged into a single event per frame
+        ///
+        /// @return Are mouse move events coalesced?
+        ///
+        /// @see setMouseMoveCoalescingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isMouseMoveCoalescingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the mouse move events that were stored by handleEvent to the widgets as a single event
+        ///
+        /// @return Has the mouse move event been consumed? Returns false when there were no stored mouse move events.
+        ///
+        /// You only need to call this function if you want the widgets to react to mouse movement before drawing the gui.
+        /// @see setMouseMoveCoalescingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processCoalescedMouseMoves();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all mouse positions that were merged into the last mouse move event that was passed to the widgets
+        ///
+        /// @return Mouse positions in gui coordinates, from oldest to newest. The last position is the one the widgets received.
+        ///
+        /// This can be used by widgets that need every intermediate point (e.g. when drawing lines on a Canvas) while the gui
+        /// only processes the last mouse position. When coalescing is disabled, only the last mouse position is returned.
+        /// @see setMouseMoveCoalescingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<Vector2f>& getCoalescedMousePositions() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief When the tab key usage is enabled, pressing tab will focus another widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,6 +633,44 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be called on the gui thread
+        ///
+        /// @param func  Function to call the next time the gui updates its time
+        ///
+        /// This is the only function of the gui that may be called from other threads. The function is stored without locking
+        /// and is called at the start of the next updateTime() call, which happens at least once per frame. If the gui is
+        /// waiting for events inside mainLoop() then it will be woken up.
+        ///
+        /// Functions are called in the order in which they were posted. If a function throws an exception then the other functions
+        /// are still called, after which the first exception is rethrown from updateTime().
+        ///
+        /// @code
+        /// std::thread worker([&gui, listView]{
+        ///     const auto rows = loadRows();
+        ///     gui.post([listView, rows]{ listView->addMultipleItems(rows); });
+        /// });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be called on the gui thread, replacing earlier functions posted with the same key
+        ///
+        /// @param func         Function to call the next time the gui updates its time
+        /// @param coalesceKey  Key that identifies what the function updates
+        ///
+        /// When multiple functions are posted with the same key before the gui thread gets to process them, only the function
+        /// that was posted last is called. This allows a worker thread to post an update for every change it makes (e.g. every
+        /// time a row changes) while the gui only processes the latest state once per frame.
+        ///
+        /// This function may be called from any thread.
+        /// @see post(std::function<void()>)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> func, std::uint64_t coalesceKey);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Converts the pixel coordinate to a position within the view
         /// @param pixel  coordinate on the window
@@ -666,12 +762,34 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleTwoFingerScroll(bool wasAlreadyScrolling);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Hides the visible tool tip and restarts the delay before a new tool tip can be shown. Called when the mouse moves.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetToolTip();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the view and changes the size of the root container when needed.
         // Derived classes should update m_framebufferSize in this function and then call this function from the base class.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateContainerSize();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls the functions that were passed to post(). Returns whether any function was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool invokePostedFunctions();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sleeps until the timeout expires or until a function is posted, whichever comes first.
+        // This is used by the main loops that don't have a way to wait for events from the windowing library.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForPostedFunctions(Duration timeout);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wakes up the main loop after a function was posted. This function is called from the thread that called post().
+        // Derived classes can override this function to wake up a main loop that waits for events from the windowing library.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void wakeUpMainLoop();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
@@ -702,11 +820,36 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
         bool m_keyboardNavigationEnabled = false; // TGUI_NEXT: Enable by default?
+        bool m_mouseMoveCoalescingEnabled = false;
+
+        std::vector<Vector2i> m_pendingMouseMoves; // Pixel positions of mouse move events that weren't passed to the widgets yet
+        std::vector<Vector2f> m_coalescedMousePositions;
 
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
         std::shared_ptr<BackendRenderTarget> m_backendRenderTarget = nullptr;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct PostedFunction
+        {
+            PostedFunction* next;
+            std::function<void()> func;
+            std::uint64_t coalesceKey;
+            bool coalesce;
+        };
+
+        void pushPostedFunction(PostedFunction* node);
+
+        // Posted functions that haven't been called yet, with the most recently posted function at the front.
+        // Other threads only push to the front of the list, the gui thread takes the entire list at once.
+        std::atomic<PostedFunction*> m_postedFunctions{nullptr};
+
+        std::mutex m_postedFunctionsMutex; // Only used to wait for posted functions, posting never locks
+        std::condition_variable m_postedFunctionsCondition;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,6 +255,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateContainerSize() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Posts an empty event to wake up glfwWaitEvents after a function was posted from another thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpMainLoop() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -34,6 +34,7 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
     #include <memory>
+    #include <vector>
     #include <set>
 #endif
 
@@ -150,35 +151,17 @@ namespace dev
 
         StyleProperty(const StyleProperty& other) :
             m_defaultValue  {other.m_defaultValue},
+            m_storedStates  {other.m_storedStates},
             m_messageTopicId{MessageBroker::createTopic()},
-            m_globalValues  {other.m_globalValues}
+            m_values        {other.m_values}
         {
-            unsetValue();
-
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint64_t oldBaseIndex = other.m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint16_t oldStoredStates = static_cast<std::uint16_t>(other.m_propertyData & 0xFFFF);
-
-            std::uint16_t total = 0;
-            std::uint8_t bitIndex = 0;
-            while (total < oldStoredStates)
-            {
-                if (oldStoredStates & (1 << bitIndex))
-                {
-                    m_globalValues[baseIndex + bitIndex] = m_globalValues[oldBaseIndex + bitIndex];
-                    total += static_cast<std::uint16_t>(1 << bitIndex);
-                }
-                ++bitIndex;
-            }
-
-            m_propertyData = baseIndex | oldStoredStates;
         }
 
         StyleProperty(StyleProperty&& other) noexcept :
             m_defaultValue  {std::move(other.m_defaultValue)},
-            m_propertyData  {std::move(other.m_propertyData)},
+            m_storedStates  {std::move(other.m_storedStates)},
             m_messageTopicId{std::move(other.m_messageTopicId)},
-            m_globalValues  {std::move(other.m_globalValues)}
+            m_values        {std::move(other.m_values)}
         {
             other.m_messageTopicId = 0;
         }
@@ -187,7 +170,6 @@ namespace dev
         {
             if (m_messageTopicId) // Can be 0 on moved object
                 MessageBroker::destroyTopic(m_messageTopicId);
-            unsetValueImpl();
         }
 
         StyleProperty& operator=(const StyleProperty& other)
@@ -196,9 +178,9 @@ namespace dev
             {
                 StyleProperty temp(other);
                 std::swap(m_defaultValue,   temp.m_defaultValue);
-                std::swap(m_propertyData,   temp.m_propertyData);
+                std::swap(m_storedStates,   temp.m_storedStates);
                 std::swap(m_messageTopicId, temp.m_messageTopicId);
-                std::swap(m_globalValues,   temp.m_globalValues);
+                std::swap(m_values,         temp.m_values);
             }
 
             return *this;
@@ -209,9 +191,9 @@ namespace dev
             if (&other != this)
             {
                 m_defaultValue = std::move(other.m_defaultValue);
-                m_propertyData = std::move(other.m_propertyData);
+                m_storedStates = std::move(other.m_storedStates);
                 m_messageTopicId = std::move(other.m_messageTopicId);
-                m_globalValues = std::move(other.m_globalValues);
+                m_values = std::move(other.m_values);
 
                 other.m_messageTopicId = 0;
             }
@@ -228,18 +210,25 @@ namespace dev
 
         void setValue(const ValueType& value, ComponentState state = ComponentState::Normal)
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            m_propertyData |= static_cast<std::uint64_t>(1) << static_cast<std::uint8_t>(state);
-            m_globalValues[baseIndex + static_cast<std::uint8_t>(state)] = value;
+            const auto index = static_cast<std::ptrdiff_t>(getValueIndex(state));
+            if (hasValue(state))
+                m_values[static_cast<std::size_t>(index)] = value;
+            else
+            {
+                m_values.insert(m_values.begin() + index, value);
+                m_storedStates |= getStateBit(state);
+            }
 
             MessageBroker::sendEvent(m_messageTopicId);
         }
 
         void unsetValue(ComponentState state)
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            m_propertyData &= ~(static_cast<std::uint64_t>(1) << static_cast<std::uint8_t>(state));
-            m_globalValues.erase(baseIndex + static_cast<std::uint8_t>(state));
+            if (hasValue(state))
+            {
+                m_values.erase(m_values.begin() + static_cast<std::ptrdiff_t>(getValueIndex(state)));
+                m_storedStates &= static_cast<std::uint16_t>(~getStateBit(state));
+            }
 
             MessageBroker::sendEvent(m_messageTopicId);
         }
@@ -252,65 +241,62 @@ namespace dev
 
         TGUI_NODISCARD const ValueType& getValue(ComponentState state = ComponentState::Normal) const
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint16_t storedStates = static_cast<std::uint16_t>(m_propertyData & 0xFFFF);
-
             // If we don't have a value for any state then we can just return the default value
-            if (storedStates == 0)
+            if (m_storedStates == 0)
                 return m_defaultValue;
 
             // If we only have a value for the Normal state then always use this value
-            if (storedStates == 1)
-                return m_globalValues.at(baseIndex);
+            if (m_storedStates == 1)
+                return m_values[0];
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Disabled))
             {
-                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Active)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::DisabledActive))))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::DisabledActive));
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Disabled)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Disabled));
+                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Active)) && hasValue(ComponentState::DisabledActive))
+                    return getStoredValue(ComponentState::DisabledActive);
+                if (hasValue(ComponentState::Disabled))
+                    return getStoredValue(ComponentState::Disabled);
             }
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Active))
             {
                 if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Hover))
                 {
-                    if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::FocusedActiveHover))))
-                        return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::FocusedActiveHover));
-                    if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::ActiveHover)))
-                        return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::ActiveHover));
+                    if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && hasValue(ComponentState::FocusedActiveHover))
+                        return getStoredValue(ComponentState::FocusedActiveHover);
+                    if (hasValue(ComponentState::ActiveHover))
+                        return getStoredValue(ComponentState::ActiveHover);
                 }
 
-                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::FocusedActive))))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::FocusedActive));
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Active)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Active));
+                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && hasValue(ComponentState::FocusedActive))
+                    return getStoredValue(ComponentState::FocusedActive);
+                if (hasValue(ComponentState::Active))
+                    return getStoredValue(ComponentState::Active);
             }
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Hover))
             {
-                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::FocusedHover))))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::FocusedHover));
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Hover)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Hover));
+                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && hasValue(ComponentState::FocusedHover))
+                    return getStoredValue(ComponentState::FocusedHover);
+                if (hasValue(ComponentState::Hover))
+                    return getStoredValue(ComponentState::Hover);
             }
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused))
             {
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Focused)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Focused));
+                if (hasValue(ComponentState::Focused))
+                    return getStoredValue(ComponentState::Focused);
             }
 
-            if (storedStates & 1)
+            if (hasValue(ComponentState::Normal))
             {
-                // We have a value for the Normal state, so return it. It is possible to pass here while storedStates != 1 when there
+                // We have a value for the Normal state, so return it. It is possible to pass here while m_storedStates != 1 when there
                 // is e.g. a value for both Normal and Disabled state and the widget is enabled.
-                return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Normal));
+                return m_values[0];
             }
             else
             {
-                // We don't have any relevant values, so return the default value. It is possible to pass here while storedStates > 0 when
-                // there is e.g. only a value for the Disabled state and the widget is enabled.
+                // We don't have any relevant values, so return the default value. It is possible to pass here while m_storedStates > 0
+                // when there is e.g. only a value for the Disabled state and the widget is enabled.
                 return m_defaultValue;
             }
         }
@@ -329,44 +315,52 @@ namespace dev
 
         void unsetValueImpl()
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint16_t storedStates = static_cast<std::uint16_t>(m_propertyData & 0xFFFF);
+            m_storedStates = 0;
+            m_values.clear();
+        }
+
+        TGUI_NODISCARD static std::uint16_t getStateBit(ComponentState state)
+        {
+            return static_cast<std::uint16_t>(1 << static_cast<std::uint8_t>(state));
+        }
+
+        TGUI_NODISCARD bool hasValue(ComponentState state) const
+        {
+            return (m_storedStates & getStateBit(state)) != 0;
+        }
 
-            std::uint16_t total = 0;
-            std::uint8_t bitIndex = 0;
-            while (total < storedStates)
+        // Returns the position in m_values where the value for the state is or would be stored,
+        // which is the amount of stored states that come before it.
+        TGUI_NODISCARD std::size_t getValueIndex(ComponentState state) const
+        {
+            std::uint16_t lowerStates = static_cast<std::uint16_t>(m_storedStates & (getStateBit(state) - 1));
+            std::size_t count = 0;
+            while (lowerStates)
             {
-                if (storedStates & (1 << bitIndex))
-                {
-                    m_globalValues.erase(baseIndex + bitIndex);
-                    total += static_cast<std::uint16_t>(1 << bitIndex);
-                }
-                ++bitIndex;
+                lowerStates &= static_cast<std::uint16_t>(lowerStates - 1);
+                ++count;
             }
+            return count;
+        }
 
-            m_propertyData = baseIndex; // Forget about the states that were stored
+        TGUI_NODISCARD const ValueType& getStoredValue(ComponentState state) const
+        {
+            return m_values[getValueIndex(state)];
         }
 
     private:
 
         ValueType m_defaultValue;
 
-        // The highest 48 bits store the index in a static map of values (see below).
-        // The next 16 bits are used to indicate the set of states that are present for this property.
-        std::uint64_t m_propertyData = 0;
+        // Bitmask of the states that have a value, bit N is set when a value for the ComponentState with value N is stored
+        std::uint16_t m_storedStates = 0;
 
         // Index of the event that we publish to when the property changes.
         std::uint64_t m_messageTopicId = 0;
 
-        // All values are stored in a static map, which can be seen as a very large sparse list.
-        // Each instance holds a unique 48-bit id that can be seen as the high bits of the index in the list.
-        // The lowest 4 bits of the index contain the widget state. The remaining 12 bits inbetween are always 0.
-        ///static std::unordered_map<std::uint64_t, ValueType> m_globalValues;
-        ///static std::uint64_t m_nextGlobalValueIndex;
-
-        /// TODO: The system with global values caused way too many implementation and platform-specific problems.
-        ///       For now we just store the values in the StyleProperty itself.
-        std::unordered_map<std::uint64_t, ValueType> m_globalValues;
+        // Values for the states in m_storedStates, ordered by state. Most properties only have a few states that are set,
+        // so the values are stored densely and the position of a state is found by counting the lower bits in m_storedStates.
+        std::vector<ValueType> m_values;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -434,6 +434,45 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool processTextEnteredEvent(char32_t key);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are rendered to an offscreen texture that is reused while nothing changes
+        ///
+        /// @param cached  Should the contents of the container be cached as a layer?
+        ///
+        /// When a container is cached as a layer, its child widgets are drawn to a texture which is drawn again in the next
+        /// frames without drawing the widgets themselves. The texture is only rendered again after a child widget changed.
+        /// This is intended for large containers with static contents, as a frequently changing widget inside the container
+        /// causes the entire layer to be redrawn.
+        ///
+        /// Events, animations and anything changed while handling them are detected automatically, as are changes to the
+        /// position, size, visibility, font, text size and renderer properties of child widgets. When the contents of a
+        /// child widget are changed from elsewhere (e.g. calling setText on a label from your main loop or from a Timer, or
+        /// drawing on a canvas), you need to call invalidateLayer() to update the cached contents.
+        ///
+        /// Only the OpenGL3 and GLES2 backend renderers support rendering to a layer, with other renderers this option does
+        /// nothing. Caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCachedAsLayer(bool cached);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are rendered to an offscreen texture that is reused while nothing changes
+        ///
+        /// @return Is the container cached as a layer?
+        ///
+        /// @see setCachedAsLayer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isCachedAsLayer() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the cached contents of the container and of the containers it is in as outdated
+        ///
+        /// The child widgets will be drawn again the next time the gui is drawn. This only has an effect for containers that
+        /// are cached as a layer.
+        ///
+        /// @see setCachedAsLayer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateLayer();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Called when one of the child widgets of this container gains focus.
@@ -558,6 +597,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw(BackendRenderTarget& target, RenderStates states) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of the visible part of the child widgets, relative to the position where the children are drawn.
+        // This is where the layer starts when the container is cached as a layer (e.g. the scroll offset in ScrollablePanel).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Vector2f getLayerOffset() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,6 +676,11 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        bool m_cachedAsLayer = false;
+        mutable bool m_layerInvalidated = true;
+        mutable std::shared_ptr<BackendTexture> m_layerTexture;
+        mutable FloatRect m_layerRect; // Offset and size of the layer when it was last rendered
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -32,6 +32,7 @@
     #include <cstdint>
     #include <vector>
     #include <ctime>
+    #include <functional>
 
     #ifdef TGUI_USE_STD_FILESYSTEM
         #include <filesystem>
@@ -378,6 +379,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return List of files (including directories) that are found within the given path
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::vector<FileInfo> listFilesInDirectory(const Path& path);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lists all files and folders inside a given directory, passing them to a callback in chunks
+        ///
+        /// @param path       Path in which all directories and files should be listed
+        /// @param chunkSize  Maximum amount of entries that are passed to the callback at once
+        /// @param chunkFunc  Function that receives the entries. Returning false from it stops the listing.
+        ///
+        /// Unlike the other overload, the caller can process entries before the entire directory has been read,
+        /// and can abort reading a huge directory. This function can safely be called from a thread other than the gui thread.
+        ///
+        /// @return False if the listing was aborted by the callback, true otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool listFilesInDirectory(const Path& path, std::size_t chunkSize,
+                                         const std::function<bool(std::vector<FileInfo>&& files)>& chunkFunc);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,12 +28,14 @@
 
 #include <TGUI/String.hpp>
 #include <TGUI/Rect.hpp>
+#include <TGUI/TextStyle.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
     #include <string>
     #include <cstddef>
     #include <memory>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +238,83 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields instead of as bitmaps
+        ///
+        /// @param enabled  Should each glyph be rasterized only once, at a reference size, and be scaled when rendering?
+        ///
+        /// This avoids rasterizing the glyphs again for each character size and outline thickness, which is useful when
+        /// text is zoomed. Only the FreeType font backend supports this, and text must be drawn with the OpenGL3 or GLES2
+        /// render target. Distance field mode is disabled by default.
+        ///
+        /// The outline thickness of text using the font is limited to 1/8 of the character size in this mode, thicker outlines
+        /// are drawn with that thickness.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields instead of as bitmaps
+        ///
+        /// @return Is each glyph only rasterized once, at a reference size, and scaled when rendering?
+        ///
+        /// @see setDistanceFieldEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs in advance, so that showing text with these characters for the first time doesn't cause a delay
+        ///
+        /// @param characters      Characters for which the glyphs should be loaded
+        /// @param characterSizes  Character sizes at which the glyphs should be loaded
+        /// @param style           Style of the text (only the bold style affects the glyphs)
+        ///
+        /// The FreeType font backend rasterizes the glyphs on a background thread and adds them to the font texture when
+        /// the font is used after they have been loaded. Other backends load the glyphs before this function returns.
+        ///
+        /// @code
+        /// font.preload(U"0123456789", {18, 24});
+        /// font.preload(U"0123456789", {24}, tgui::TextStyle::Bold);
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const String& characters, const std::vector<unsigned int>& characterSizes, TextStyles style = TextStyle::Regular);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs that were requested with the preload function are still being loaded in the background
+        ///
+        /// @return Is a background thread still loading glyphs?
+        ///
+        /// @see preload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPreloading() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the directory in which preloaded glyphs are stored, so that they don't have to be rasterized again
+        ///
+        /// @param directory  Existing directory in which cache files are stored, or an empty string to not cache glyphs on disk
+        ///
+        /// When a directory is set, the glyphs that are loaded by the preload function are written to a file in this directory
+        /// and are read from that file the next time they are preloaded, e.g. when the program is started again.
+        /// The cache files are named after a hash of the font file, so the same directory can be shared between fonts.
+        ///
+        /// @see preload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlyphCacheDirectory(const String& directory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the directory in which preloaded glyphs are stored
+        ///
+        /// @return Directory in which cache files are stored, or an empty string if glyphs aren't cached on disk
+        ///
+        /// @see setGlyphCacheDirectory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getGlyphCacheDirectory() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal font
         /// @return Backend font that is used internally
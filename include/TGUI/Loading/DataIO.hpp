@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/String.hpp>
+#include <TGUI/StringView.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <sstream>
@@ -37,6 +38,7 @@
     #include <string>
     #include <map>
     #include <cstdio>
+    #include <cstdint>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,6 +107,18 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file
+        ///
+        /// @param data  UTF-8 contents of the widget file
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// This function reads directly from the given memory, so it can be used on the contents of a file without copying it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parse(CharStringView data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -113,6 +127,46 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file or theme file that was stored in the binary format
+        ///
+        /// @param data  Contents of the file, as written by emitBinary
+        /// @param size  Size of the data in bytes
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data is not a valid binary file
+        ///
+        /// The caller has to provide the entire file in memory (e.g. with readFileToMemory). Every distinct string is only
+        /// decoded once, but each node still gets its own copy of the strings that it contains.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parseBinary(const std::uint8_t* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the tree of nodes in a compact binary format that can be loaded faster than the text format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be converted to binary data
+        /// @param stream   Stream to which the binary data will be added
+        ///
+        /// Comments, whitespace and section inheritance are already resolved in the binary data, and every distinct key,
+        /// value and section name is only stored once. Values are stored as strings, they are converted to their actual type
+        /// by the widget loaders in the same way as when loading from the text format.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the data starts with the header that is written by emitBinary
+        ///
+        /// @param data  Contents of the file
+        /// @param size  Size of the data in bytes
+        ///
+        /// @return True if the data should be loaded with parseBinary, false if it should be loaded with parse
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isBinary(const std::uint8_t* data, std::size_t size);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
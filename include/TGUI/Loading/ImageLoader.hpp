@@ -33,6 +33,7 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
     #include <memory>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +68,45 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes images on multiple threads so that they no longer need to be decoded when loadFromFile is called
+        ///
+        /// @param filenames  Files that are going to be loaded with loadFromFile
+        ///
+        /// This function blocks until all images are decoded. Each preloaded image is returned by loadFromFile only once,
+        /// the image is removed from the cache after it has been returned. Images that are never requested are kept in memory
+        /// until releasePreloadedFiles is called with the same filenames, so every call to this function should be matched by
+        /// a call to releasePreloadedFiles. Images that were already preloaded by an earlier call aren't decoded again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void preloadFiles(const std::vector<String>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Frees the memory of images that were preloaded with preloadFiles but that were never loaded
+        ///
+        /// @param filenames  Files that were passed to preloadFiles
+        ///
+        /// An image that was passed to preloadFiles multiple times is only freed once it has been released the same amount of times.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releasePreloadedFiles(const std::vector<String>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Frees the memory of all images that were preloaded with preloadFiles but that were never loaded
+        ///
+        /// @see releasePreloadedFiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearPreloadedFiles();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Decodes the images on multiple threads and adds them to the preloaded images
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void decodePreloadedFiles(const std::vector<String>& filenames);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,8 +57,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @internal
         TGUI_NODISCARD static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
+        /// @internal
+        /// Gives the widgets in copyOnWriteObservers their own copy of the data, right before the data gets changed
+        void detachCopyOnWriteObservers();
+
         std::map<String, ObjectConverter> propertyValuePairs;
         std::unordered_set<Widget*> observers;
+        std::unordered_set<Widget*> copyOnWriteObservers;
         Theme* connectedTheme = nullptr;
         bool themePropertiesInherited = false;
         bool shared = true;
@@ -247,6 +252,26 @@ TGUI_MODULE_EXPORT namespace tgui
         void unsubscribe(Widget* widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Keeps sharing the renderer data until a property is changed, at which point the widget gets its own copy
+        ///
+        /// @param widget  The widget that subscribed to this renderer, or nullptr to stop delaying the copy
+        ///
+        /// You are not supposed to call this function yourself, use the getRenderer function of the widget instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCopyOnWrite(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether the renderer data still needs to be copied before it can be changed via this renderer
+        ///
+        /// @return Was setCopyOnWrite called while the data was still being shared?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isCopyOnWrite() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Directly change all the data of this renderer
@@ -282,6 +307,10 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::shared_ptr<RendererData> m_data = RendererData::create();
 
+    private:
+
+        Widget* m_copyOnWriteObserver = nullptr;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
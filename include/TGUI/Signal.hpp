@@ -36,13 +36,11 @@
 #include <TGUI/Filesystem.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
-    #include <unordered_map>
     #include <type_traits>
     #include <functional>
     #include <typeindex>
     #include <memory>
     #include <vector>
-    #include <deque>
 #endif
 
 #undef MessageBox  // windows.h defines MessageBox when NOMB isn't defined before including windows.h
@@ -63,22 +61,21 @@ TGUI_MODULE_EXPORT namespace tgui
     public:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default destructor
+        /// @brief Destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual ~Signal() = default;
+        virtual ~Signal();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param name  Name of the signal
+        ///
+        /// The second parameter is no longer used, the parameters of the signal are passed to the handlers on the stack.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(String&& name, std::size_t extraParameters = 0) :
+        Signal(String&& name, std::size_t = 0) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > m_parameters.size())
-                m_parameters.resize(1 + extraParameters);
         }
 
 
@@ -89,9 +86,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default move constructor
+        /// @brief Move constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(Signal&& other) noexcept = default;
+        Signal(Signal&& other) noexcept;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,9 +98,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default move assignment operator
+        /// @brief Move assignment operator
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& operator=(Signal&& other) noexcept = default;
+        Signal& operator=(Signal&& other) noexcept;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -132,17 +129,14 @@ TGUI_MODULE_EXPORT namespace tgui
         template <typename Func, typename... BoundArgs, typename std::enable_if_t<std::is_convertible<Func, std::function<void(const BoundArgs&...)>>::value>* = nullptr>
         unsigned int connect(const Func& func, const BoundArgs&... args)
         {
-            const auto id = ++m_lastSignalId;
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                return addHandler(func);
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                return addHandler([=]{ invokeFunc(func, args...); });
             }
-
-            return id;
         }
 
 
@@ -184,6 +178,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param widget  The sender of the signal
         ///
         /// @return True when at least one signal handler was called
+        ///
+        /// Handlers are allowed to connect and disconnect handlers, to emit signals and to destroy the widget while the signal
+        /// is being emitted. Handlers that are connected during the emission will only be called the next time the signal is
+        /// emitted, handlers that are disconnected during the emission are no longer called.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget);
 
@@ -230,6 +228,35 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a handler that will be called when the signal is emitted
+        ///
+        /// @param handler  Function to call, which can access the parameters of the emission with dereferenceParam
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addHandler(std::function<void()> handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls all connected signal handlers
+        ///
+        /// @param parameters  Pointers to the parameters of the signal, the first element has to point to the widget pointer
+        ///
+        /// @return True when at least one signal handler was called
+        ///
+        /// The parameters remain available to the handlers through dereferenceParam while they are being called. They are
+        /// stored per thread and are restored after a nested emission ends, so handlers are allowed to emit other signals.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool emitImpl(const void* const* parameters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a parameter of the signal that is currently being emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const void* getParameter(std::size_t paramIndex);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +269,7 @@ TGUI_MODULE_EXPORT namespace tgui
         template <typename Type>
         TGUI_NODISCARD static const std::decay_t<Type>& dereferenceParam(std::size_t paramIndex)
         {
-            return *static_cast<const std::decay_t<Type>*>(m_parameters[paramIndex]);
+            return *static_cast<const std::decay_t<Type>*>(getParameter(paramIndex));
         }
 
 
@@ -271,12 +298,35 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct Handler
+        {
+            unsigned int id; // 0 when the handler was disconnected during an emission
+            std::function<void()> func;
+        };
+
+        // Information about an emission that is in progress, stored on the stack of emitImpl
+        struct EmitState
+        {
+            EmitState* previous = nullptr; // Emission of the same signal that was in progress when this one started
+            bool signalDestroyed = false;
+            std::vector<Handler> handlersKeptAlive; // Handlers of a destroyed signal, which may still be executing
+        };
+
         bool m_enabled = true;
         String m_name;
-        std::unordered_map<unsigned int, std::function<void()>> m_handlers;
+        std::vector<Handler> m_handlers; // Handlers are called in the order in which they were connected
+        std::vector<Handler> m_handlersConnectedDuringEmit;
+        EmitState* m_emitState = nullptr;
+        bool m_handlersDisconnectedDuringEmit = false;
 
         static unsigned int m_lastSignalId;
-        static std::deque<const void*> m_parameters;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Applies the changes to the handlers that were made during the emission, once the outermost emission ends
+        void finishEmit(EmitState& state);
     };
 
 
@@ -358,8 +408,8 @@ TGUI_MODULE_EXPORT namespace tgui
             if (m_handlers.empty())
                 return false;
 
-            m_parameters[1] = static_cast<const void*>(&param);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&param)};
+            return emitImpl(parameters);
         }
     };
 
@@ -443,9 +493,8 @@ TGUI_MODULE_EXPORT namespace tgui
             if (m_handlers.empty())
                 return false;
 
-            m_parameters[1] = static_cast<const void*>(&param1);
-            m_parameters[2] = static_cast<const void*>(&param2);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&param1), static_cast<const void*>(&param2)};
+            return emitImpl(parameters);
         }
     };
 
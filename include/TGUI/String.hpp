@@ -1508,6 +1508,23 @@ TGUI_MODULE_EXPORT namespace tgui
 #endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Hash function for using String as key in the unordered containers inside widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct StringHash
+        {
+            std::size_t operator()(const String& str) const noexcept
+            {
+                return std::hash<std::u32string>{}(str.toUtf32());
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
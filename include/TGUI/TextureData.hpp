@@ -51,6 +51,9 @@ TGUI_MODULE_EXPORT namespace tgui
         // Either svgImage or backendTexture MUST have a value
         Optional<SvgImage> svgImage;
         std::shared_ptr<BackendTexture> backendTexture;
+
+        // Part of backendTexture that contains the image when it was packed in an atlas page, empty when it has its own texture
+        UIntRect atlasRect;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
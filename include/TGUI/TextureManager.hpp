@@ -34,6 +34,7 @@
     #include <memory>
     #include <list>
     #include <map>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,10 +94,124 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::size_t getCachedImagesCount();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Checks whether an image was already loaded by the texture manager
+        ///
+        /// @param filename  Filename of the image, as passed to getTexture
+        ///
+        /// @return True if the image is still in use by a texture and thus doesn't need to be loaded from the file again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isImageCached(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images are packed together in shared atlas textures
+        ///
+        /// @param enabled  Should images that are loaded from now on be placed in atlas pages?
+        ///
+        /// When enabled, images (except for svg images) that are not larger than getAtlasMaxImageSize() in both directions are
+        /// copied into a larger texture that is shared with other images that were loaded with the same smooth setting.
+        /// Sprites that use images from the same page can be rendered with the same texture, so there are less texture switches.
+        /// The returned textures still behave as if they only contain the image, their part rect is relative to the image.
+        ///
+        /// Space that was used by an image only becomes available again once all images in the page are no longer used.
+        ///
+        /// The atlas is disabled by default. Changing this setting has no effect on images that were already loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together in shared atlas textures
+        ///
+        /// @return Are images that are loaded placed in atlas pages?
+        ///
+        /// @see setAtlasEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width and height of the textures that are created to store the images of the atlas
+        ///
+        /// @param size  Width and height of new atlas pages (default: 1024)
+        ///
+        /// Changing the size only affects pages that are created afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasPageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of the textures that are created to store the images of the atlas
+        ///
+        /// @return Width and height of new atlas pages
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static unsigned int getAtlasPageSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum width and height of images that will be placed in an atlas page
+        ///
+        /// @param size  Images that are wider or higher than this size get their own texture (default: 128)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasMaxImageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum width and height of images that will be placed in an atlas page
+        ///
+        /// @return Images that are wider or higher than this size get their own texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static unsigned int getAtlasMaxImageSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many atlas pages currently exist
+        ///
+        /// @return Number of textures that contain images packed by the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAtlasPageCount();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Horizontal segment of the top edge of the area that is already used in an atlas page
+        struct SkylineSegment
+        {
+            unsigned int x;
+            unsigned int y;
+            unsigned int width;
+        };
+
+        // Texture that is shared by multiple small images
+        struct AtlasPage
+        {
+            std::shared_ptr<BackendTexture> texture;
+            std::vector<SkylineSegment> skyline;
+            bool smooth = true;
+            unsigned int images = 0;
+        };
+
+        // Copies the pixels into an atlas page and lets the texture data refer to it. Returns false if the image didn't fit.
+        static bool addImageToAtlas(TextureData& data, Vector2u size, const std::uint8_t* pixels, bool smooth);
+
+        // Searches for the lowest location where a rectangle of the given size fits in the page, using the skyline algorithm
+        static bool findAtlasLocation(const AtlasPage& page, Vector2u size, std::size_t& segmentIndex, Vector2u& location);
+
+        // Marks the rectangle as used in the skyline of the page
+        static void insertAtlasRect(AtlasPage& page, std::size_t segmentIndex, const UIntRect& rect);
+
+        // Removes the image from its atlas page and destroys the page if no other image is using it anymore
+        static void removeImageFromAtlas(const TextureData& data);
+
         static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        static std::list<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
+        static unsigned int m_atlasPageSize;
+        static unsigned int m_atlasMaxImageSize;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/Rect.hpp>
+#include <TGUI/Vertex.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <array>
@@ -40,7 +41,10 @@
 TGUI_MODULE_EXPORT namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// @brief Defines a transform matrix
+    /// @brief Defines a 2D affine transform matrix
+    ///
+    /// Only the 6 values that can differ in a 2D affine transformation are stored. The full 4x4 matrix is only created when
+    /// calling getMatrix, which is meant for passing the transform to a graphics API.
     // Based on sf::Transform from SFML
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Transform
@@ -67,6 +71,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param a20  Element (2, 0) of the 3x3 matrix
         /// @param a21  Element (2, 1) of the 3x3 matrix
         /// @param a22  Element (2, 2) of the 3x3 matrix
+        ///
+        /// The transform is assumed to be affine, the last row of the matrix (a20, a21, a22) should be (0, 0, 1).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Transform(float a00, float a01, float a02,
                   float a10, float a11, float a12,
@@ -77,6 +83,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Constructs a transform from a 4x4 matrix
         ///
         /// @param matrix  4x4 transform matrix, similar to what getMatrix returns
+        ///
+        /// Only the elements that are part of a 2D affine transformation are used, the rest of the matrix is ignored.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Transform(const std::array<float, 16>& matrix);
 
@@ -93,7 +101,7 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return 4x4 transform matrix
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::array<float, 16>& getMatrix() const;
+        TGUI_NODISCARD std::array<float, 16> getMatrix() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +124,18 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Vector2f transformPoint(const Vector2f& point) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Transforms the positions of multiple vertices
+        ///
+        /// @param vertices     Pointer to the first vertex, the positions of the vertices are replaced by the transformed points
+        /// @param vertexCount  Amount of vertices to transform
+        ///
+        /// This gives the same result as calling transformPoint on the position of each vertex, but it uses SSE2 or NEON
+        /// instructions when they are available.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void transformVertexPositions(Vertex* vertices, std::size_t vertexCount) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Transform a rectangle
         ///
@@ -203,7 +223,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        std::array<float, 16> m_matrix; //!< 4x4 matrix defining the transformation
+        // 3x2 matrix defining the transformation, stored column by column: a00, a10, a01, a11, a02, a12
+        std::array<float, 6> m_matrix;
     };
 }
 
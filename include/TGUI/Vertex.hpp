@@ -29,6 +29,7 @@
 #include <TGUI/Vector2.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cstdint>
 #endif
 
@@ -65,6 +66,31 @@ TGUI_MODULE_EXPORT namespace tgui
         Color color;
         Vector2f texCoords;
     };
+
+    // Vertex that stores its texture coordinates as normalized 16-bit integers (where 65535 represents 1).
+    // Render targets that support it can send these to the GPU instead of Vertex objects, to reduce the amount of uploaded data.
+    struct TGUI_API PackedVertex
+    {
+        PackedVertex() = default;
+
+        explicit PackedVertex(const Vertex& vertex) :
+            position {vertex.position},
+            color    {vertex.color},
+            texCoordX{packTexCoord(vertex.texCoords.x)},
+            texCoordY{packTexCoord(vertex.texCoords.y)}
+        {
+        }
+
+        static std::uint16_t packTexCoord(float texCoord)
+        {
+            return static_cast<std::uint16_t>(std::min(std::max(texCoord, 0.f), 1.f) * 65535.f + 0.5f);
+        }
+
+        Vector2f position;
+        Vertex::Color color;
+        std::uint16_t texCoordX = 0;
+        std::uint16_t texCoordY = 0;
+    };
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
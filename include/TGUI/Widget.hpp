@@ -141,6 +141,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
         /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        ///          The renderer data is only actually copied when a property is changed for the first time.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual WidgetRenderer* getRenderer();
 
@@ -473,6 +474,23 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2f getRotationOrigin() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the transformation that maps points relative to the widget to the coordinate system of its parent
+        ///
+        /// The transformation combines the position, origin, rotation and scale of the widget. It is cached and only recalculated
+        /// after one of these properties or the size of the widget has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Transform& getTransform() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the inverse of the transformation returned by getTransform
+        ///
+        /// Just like getTransform, the result is cached until the position, size, origin, rotation or scale of the widget changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Transform& getInverseTransform() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shows the widget by introducing it with an animation
         ///
@@ -1133,6 +1151,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void rendererChanged(const String& property);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Informs the containers that are cached as a layer that their contents have to be redrawn because this widget changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateParentLayer();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1210,6 +1233,12 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
+        // Cached results of getTransform and getInverseTransform, which are recalculated when the flags are set
+        mutable Transform m_transform;
+        mutable Transform m_inverseTransform;
+        mutable bool m_transformChanged = true;
+        mutable bool m_inverseTransformChanged = true;
+
         // Layouts that need to recalculate their value when the position or size of this widget changes
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
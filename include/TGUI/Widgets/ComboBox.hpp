@@ -489,6 +489,24 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool containsId(const String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text in the list that opens
+        ///
+        /// @param filter  Text that the shown items must contain, or an empty string to show all items
+        ///
+        /// The comparison is case-insensitive. The filter is typically set while the user is typing, see ListBox::setFilter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that the items in the list must contain to be shown
+        ///
+        /// @return Filter that was passed to setFilter, or an empty string when all items are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const String& getFilter() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the mouse wheel can be used to change the selected item while the list is closed
         ///
@@ -40,6 +40,11 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <tuple>
+    #include <atomic>
+    #include <condition_variable>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,6 +123,12 @@ TGUI_MODULE_EXPORT namespace tgui
         FileDialog& operator= (FileDialog&& right) noexcept;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~FileDialog() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Makes a copy of another file dialog
         ///
@@ -507,6 +518,19 @@ TGUI_MODULE_EXPORT namespace tgui
         void changePath(const Filesystem::Path& path, bool updateHistory);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops listing the files in the current directory, if the worker thread is still busy with it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelDirectoryListing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the files that the worker thread found since the last call to the list view.
+        // Returns true if the list view was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addListedFiles();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the back and forward buttons when the path history changes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -519,6 +543,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void sortFilesInListView();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a row for the file to the end of the list view, unless it is rejected by the selected file type filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFileToListView(const Filesystem::FileInfo& file, const Texture& icon);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Stores the selected files and closes the dialog
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -606,6 +636,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Filesystem::Path m_currentDirectory;
         std::vector<Filesystem::FileInfo> m_filesInDirectory;
         std::vector<Texture> m_fileIcons; // Same order as m_filesInDirectory
+        std::size_t m_listingGeneration = 0; // Incremented every time the list of files is cleared to show another directory
+        std::size_t m_iconsGeneration = 0; // Value of m_listingGeneration when the file icons were last requested
         std::size_t m_sortColumnIndex = 0;
         bool m_sortInversed = false;
 
@@ -622,6 +654,41 @@ TGUI_MODULE_EXPORT namespace tgui
         std::shared_ptr<FileDialogIconLoader> m_iconLoader;
 
         std::vector<Filesystem::Path> m_selectedFiles;
+
+        // Lists the files of a directory on a single worker thread. Cancelling a listing waits until the worker has stopped
+        // reading the directory, so that no files of an old directory can arrive later. The thread is joined on destruction.
+        class DirectoryListWorker
+        {
+        public:
+            DirectoryListWorker();
+            ~DirectoryListWorker();
+
+            DirectoryListWorker(const DirectoryListWorker&) = delete;
+            DirectoryListWorker& operator=(const DirectoryListWorker&) = delete;
+
+            void list(const Filesystem::Path& path);
+            void cancel();
+
+            // Moves the files that were found since the last call into the vector. Returns true once the listing is finished.
+            bool retrieveFiles(std::vector<Filesystem::FileInfo>& files);
+
+        private:
+            void run();
+
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            Filesystem::Path m_path;
+            bool m_jobAvailable = false;
+            bool m_busy = false;
+            bool m_stopping = false;
+            std::atomic<bool> m_cancelled{false};
+            std::vector<Filesystem::FileInfo> m_files; // Files that were found but not yet retrieved
+            bool m_finished = false;
+            std::thread m_thread;
+        };
+
+        std::unique_ptr<DirectoryListWorker> m_directoryListWorker; // Created when the first directory is listed
+        bool m_listingDirectory = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,11 @@
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <map>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -515,6 +520,44 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool containsId(const String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text
+        ///
+        /// @param filter  Text that the shown items must contain, or an empty string to show all items
+        ///
+        /// The comparison is case-insensitive. Items that are filtered out remain part of the list box, so functions like
+        /// getItemCount, getItems and setSelectedItemByIndex are unaffected. Only the displayed rows change.
+        ///
+        /// The list box keeps an index of the items that is created the first time a filter is set, so that filtering
+        /// stays fast while the user is typing, even with a huge amount of items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that the shown items must contain
+        ///
+        /// @return Filter that was passed to setFilter, or an empty string when all items are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const String& getFilter() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the items that are shown in the list box
+        ///
+        /// @return Indices of the items that match the filter, in the order in which they are displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<std::size_t> getFilteredItemIndices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are shown in the list box
+        ///
+        /// @return Amount of items that match the filter, which equals getItemCount() when no filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getFilteredItemCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the thumb position of the scrollbar
         ///
@@ -650,6 +693,92 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateItemPositions();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the Text object to draw for an item, creating it when the item didn't have one yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Text& getItemText(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets the Text object of an item, so that it gets recreated with the correct color and style when it is drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateItemText(int index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the text and id of a newly added item to the lookup tables
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addItemToIndices(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the lookup tables for an item that is about to be removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeItemFromIndices(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the lookup tables from scratch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildIndices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed on the given row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getItemIndexFromRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row on which an item is displayed, or -1 if the item is filtered out
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD int getRowFromItemIndex(int index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the item contains the filter text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool itemMatchesFilter(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates which items match the filter. When the new filter contains the previous filter then only the items
+        // that matched the previous filter have to be checked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateFilteredItems(bool onlyCheckFilteredItems);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an item to the index that is used for filtering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addItemToFilterIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the index that is used for filtering after the text of an item changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeItemInFilterIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes an item from the index that is used for filtering, before the item itself is erased
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeItemFromFilterIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the key of the item in the lists of the 3-character sequences of its lowercase text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertItemTrigrams(std::size_t index);
+        void eraseItemTrigrams(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Throws away the index that is used for filtering, it will be recreated when it is needed again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateFilterIndex();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the colors and text style of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -707,13 +836,31 @@ TGUI_MODULE_EXPORT namespace tgui
 
         struct Item
         {
-            Text text;
+            String text;
             Any data;
             String id;
         };
 
         std::vector<Item> m_items;
 
+        // Index of the first item with a given text or id, so that items can be found without searching through all of them
+        std::unordered_map<String, std::size_t, priv::StringHash> m_itemIndices;
+        std::unordered_map<String, std::size_t, priv::StringHash> m_idIndices;
+
+        // Text objects are only created for items that are being displayed
+        mutable std::map<std::size_t, Text> m_visibleTexts;
+
+        // Filtering of the displayed items. The lowercase item strings and the index of 3-character sequences
+        // are only created once a filter is used.
+        String m_filter;
+        String m_lowerCaseFilter;
+        std::vector<std::size_t> m_filteredItems; // Sorted indices of items that match the filter, only used when filtering
+        std::vector<String> m_lowerCaseItems;
+        std::vector<std::size_t> m_filterKeys; // Key of each item in the trigram index, keys increase with the item index
+        std::size_t m_nextFilterKey = 0;
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_trigramIndex; // Sorted item keys per trigram
+        bool m_filterIndexValid = false;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -32,6 +32,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <set>
+    #include <map>
     #include <limits>
 #endif
 
@@ -82,6 +83,61 @@ TGUI_MODULE_EXPORT namespace tgui
             bool expanded = false;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Interface that provides the items of a list view on demand
+        ///
+        /// When a model is set with setModel, the list view no longer stores the items itself. It only asks the model for
+        /// the rows that are being displayed and keeps a small cache of them. This allows showing huge amounts of rows that
+        /// can't be copied into the list view.
+        ///
+        /// The list view has to be told when the rows change, with the modelRowsInserted, modelRowsRemoved, modelRowsChanged
+        /// and modelReset functions.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Model
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Virtual destructor
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            virtual ~Model() = default;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of rows in the model
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD virtual std::size_t getRowCount() const = 0;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the text to display in a cell
+            ///
+            /// @param row     Index of the row
+            /// @param column  Index of the column (always 0 when the list view has no columns)
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD virtual String getCell(std::size_t row, std::size_t column) const = 0;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the icon to display in front of a row
+            ///
+            /// @param row  Index of the row
+            ///
+            /// Space is only reserved for icons when a fixed icon size was set in the list view (see setFixedIconSize).
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD virtual Texture getIcon(std::size_t /*row*/) const
+            {
+                return {};
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the user data of a row, which is what getItemData will return
+            ///
+            /// @param row  Index of the row
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD virtual Any getRowData(std::size_t /*row*/) const
+            {
+                return {};
+            }
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Constructor
@@ -403,6 +459,32 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeAllItems();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts making a batch of changes to the items
+        ///
+        /// Until endUpdate is called, the list view won't recalculate the column widths and scrollbars after each change to
+        /// the items, and the onItemSelect signal isn't triggered when removing a selected item. This makes adding, changing
+        /// or removing many items at once a lot faster, as the list view no longer has to search for the widest item each
+        /// time the widest item is changed or removed.
+        ///
+        /// Calls to beginUpdate can be nested, the changes are only processed when the last endUpdate is called.
+        ///
+        /// @code
+        /// listView->beginUpdate();
+        /// for (const auto& row : changedRows)
+        ///     listView->changeItem(row.index, row.texts);
+        /// listView->endUpdate();
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finishes a batch of changes that was started with beginUpdate
+        ///
+        /// The column widths, scrollbars and selection are updated once for all changes that were made since beginUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list view
         ///
@@ -473,7 +555,9 @@ TGUI_MODULE_EXPORT namespace tgui
         template <typename DataType>
         TGUI_NODISCARD DataType getItemData(std::size_t index) const
         {
-            if (index < m_items.size())
+            if (m_model && (index < m_model->getRowCount()))
+                return AnyCast<DataType>(m_model->getRowData(index));
+            else if (index < m_items.size())
                 return AnyCast<DataType>(m_items[index].data);
             else
                 throw std::bad_cast();
@@ -560,6 +644,84 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sort items based on the numeric value in a column
+        ///
+        /// @param columnIndex  The index of the column for sorting
+        /// @param ascending    Should the lowest values be placed at the top?
+        ///
+        /// Cells that don't contain a number are placed below all other items. Items with an equal value keep their order.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortNumerically(std::size_t columnIndex, bool ascending = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sort items based on a key that is calculated for each item
+        ///
+        /// @param keyFunc    Function that is called once for each item (with the index of the item) and returns its sort key
+        /// @param ascending  Should the items with the lowest key be placed at the top?
+        ///
+        /// Items with an equal key keep their order.
+        ///
+        /// Example:
+        /// @code
+        /// listView->sortByKey([&](std::size_t index){ return listView->getItemData<Order>(index).price; }, false);
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortByKey(const std::function<double(std::size_t)>& keyFunc, bool ascending = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list view display the rows from a model instead of storing the items itself
+        ///
+        /// @param model  Model that provides the rows, or nullptr to go back to storing items in the list view
+        ///
+        /// All items that were added to the list view are removed when changing the model. While a model is set, the items
+        /// can't be changed with functions such as addItem, changeItem or sort, changes have to be made in the model instead
+        /// after which the list view has to be notified with modelRowsInserted, modelRowsRemoved, modelRowsChanged or
+        /// modelReset. Functions that return items (e.g. getItemRow or getItemData) query the model.
+        ///
+        /// Only the rows that are visible are requested from the model. Auto-resizing columns don't take the width of the
+        /// rows into account when a model is used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setModel(std::shared_ptr<Model> model);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the model that provides the rows of the list view
+        ///
+        /// @return Model that was passed to setModel, or nullptr if the list view stores the items itself
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<Model> getModel() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that rows were inserted in the model
+        ///
+        /// @param first  Index of the first inserted row
+        /// @param count  Amount of rows that were inserted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void modelRowsInserted(std::size_t first, std::size_t count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that rows were removed from the model
+        ///
+        /// @param first  Index that the first removed row had
+        /// @param count  Amount of rows that were removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void modelRowsRemoved(std::size_t first, std::size_t count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that the contents of rows in the model changed
+        ///
+        /// @param first  Index of the first changed row
+        /// @param count  Amount of rows that were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void modelRowsChanged(std::size_t first, std::size_t count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that everything in the model may have changed
+        ///
+        /// The selection is cleared and all rows will be requested again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void modelReset();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -902,7 +1064,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Text createText(const String& caption);
+        TGUI_NODISCARD Text createText(const String& caption) const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for a header text from the given caption, using the preset color, font, text size and opacity
@@ -981,6 +1143,31 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateColumnWidths();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to an item that was just added or inserted, if auto-scrolling is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void autoScrollToNewItem(std::size_t index);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the order of the items. The new list will contain the item at index order[i] at position i.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reorderItems(const std::vector<std::size_t>& order);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the size of an item icon, taking the fixed icon size into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2f calculateIconSize(const Texture& texture) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the item at the given index. When a model is used, the item is created from the model if it isn't cached yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Item& getItemForDrawing(std::size_t index) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the rows from the model cache that are far away from the rows that are currently visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pruneModelItemCache(std::size_t firstVisibleItem, std::size_t lastVisibleItem) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns whether at least one column potentially has its width expanded to fill the list view
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1109,6 +1296,17 @@ TGUI_MODULE_EXPORT namespace tgui
         int m_possibleDoubleClick = false; // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_autoScroll = true; // Should the list view scroll to the bottom when a new item is added?
 
+        // Changes that were postponed because they were made between beginUpdate and endUpdate
+        unsigned int m_updateDepth = 0;
+        bool m_widestItemOutdated = false;
+        bool m_columnWidthsOutdated = false;
+        bool m_verticalScrollbarMaximumOutdated = false;
+        bool m_selectionChangedDuringUpdate = false;
+        std::size_t m_autoScrollItemAfterUpdate = std::numeric_limits<std::size_t>::max();
+
+        std::shared_ptr<Model> m_model;
+        mutable std::map<std::size_t, Item> m_modelItemCache; // Rows from the model near the visible area, by row index
+
         Sprite m_spriteHeaderBackground;
         Sprite m_spriteBackground;
 
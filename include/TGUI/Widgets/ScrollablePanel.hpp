@@ -381,6 +381,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void draw(BackendRenderTarget& target, RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the scroll offset, as the layer only needs to contain the part of the child widgets that is visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2f getLayerOffset() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
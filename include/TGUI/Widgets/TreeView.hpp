@@ -31,6 +31,17 @@
 #include <TGUI/Renderers/TreeViewRenderer.hpp>
 #include <TGUI/Text.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <condition_variable>
+    #include <functional>
+    #include <future>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
+    #include <deque>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -63,7 +74,51 @@ TGUI_MODULE_EXPORT namespace tgui
             unsigned int depth = 0;
             bool expanded = true;
             Node* parent = nullptr;
+            std::size_t index = 0; //!< Position of the node in the list of children of its parent
             std::vector<std::shared_ptr<Node>> nodes;
+            std::unordered_map<String, std::shared_ptr<Node>, priv::StringHash> nodesByText; //!< First child node with each text, for fast lookups
+            bool childrenLoaded = true; //!< False when the children still have to be requested from the child loader
+        };
+
+        /// @brief Item returned by the child loader
+        struct LoadedChild
+        {
+            String text;
+            bool expandable = false; //!< Should the children of this item also be requested from the loader once it gets expanded?
+        };
+
+        /// @brief Function that returns the children of the item with the given hierarchy
+        using ChildLoader = std::function<std::vector<LoadedChild>(const std::vector<String>& hierarchy)>;
+
+        /// @brief Refers to an item without having to look it up by its hierarchy each time it is used
+        ///
+        /// A handle stays valid until the item it refers to is removed from the tree view. A handle can only be used with the
+        /// tree view that returned it, other tree views ignore it (this includes copies of the tree view).
+        /// A default-constructed handle doesn't refer to any item and represents the root when passed as parent to addChildItem.
+        class ItemHandle
+        {
+        public:
+            ItemHandle() = default;
+
+            /// @brief Returns whether the item that the handle refers to still exists
+            TGUI_NODISCARD bool isValid() const
+            {
+                return !m_node.expired();
+            }
+
+        private:
+            ItemHandle(const std::shared_ptr<Node>& node, const TreeView* owner) :
+                m_node{node},
+                m_owner{owner},
+                m_root{false}
+            {
+            }
+
+            std::weak_ptr<Node> m_node;
+            const TreeView* m_owner = nullptr; // Tree view that contains the node
+            bool m_root = true;
+
+            friend class TreeView;
         };
 
 
@@ -233,6 +288,144 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD std::vector<ConstNode> getNodes() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new item below an existing item, without having to look up the parent by its hierarchy
+        ///
+        /// @param parent  Handle to the item that will become the parent, or a default-constructed handle to add a root item
+        /// @param text    Text of the new item
+        ///
+        /// @return Handle to the new item, or an invalid handle if the parent no longer exists
+        ///
+        /// Example code:
+        /// @code
+        /// auto vehicles = treeView->addChildItem({}, "Vehicles");
+        /// auto whole = treeView->addChildItem(vehicles, "Whole");
+        /// treeView->addChildItem(whole, "Truck");
+        /// treeView->addChildItem(whole, "Car");
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemHandle addChildItem(const ItemHandle& parent, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a collapsed item of which the children are only requested from the child loader when it gets expanded
+        ///
+        /// @param parent  Handle to the item that will become the parent, or a default-constructed handle to add a root item
+        /// @param text    Text of the new item
+        ///
+        /// @return Handle to the new item, or an invalid handle if the parent no longer exists
+        ///
+        /// @see setChildLoader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemHandle addLazyChildItem(const ItemHandle& parent, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the function that provides the children of lazy items when they are expanded for the first time
+        ///
+        /// @param loader            Function that returns the children of the item with the given hierarchy
+        /// @param loadInBackground  Should the loader be called on a worker thread?
+        ///
+        /// When loading in the background, a placeholder item is shown below the expanded item until the loader returns.
+        /// The children are added during the next updateTime() call of the gui. The loader must not access the gui or its
+        /// widgets in that case, as it is being called from another thread.
+        ///
+        /// Only expanding a single item loads its children, expandAll() leaves lazy items that weren't loaded yet collapsed.
+        ///
+        /// Example code:
+        /// @code
+        /// treeView->setChildLoader([](const std::vector<tgui::String>& hierarchy) {
+        ///     std::vector<tgui::TreeView::LoadedChild> children;
+        ///     for (const auto& entry : listDirectory(hierarchy))
+        ///         children.push_back({entry.name, entry.isDirectory});
+        ///     return children;
+        /// }, true);
+        /// treeView->addLazyChildItem({}, "Root");
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setChildLoader(const ChildLoader& loader, bool loadInBackground = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text of the placeholder item that is shown while children are being loaded in the background
+        /// @param text  Text to show while the children of an expanded item aren't available yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLoadingItemText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text of the placeholder item that is shown while children are being loaded in the background
+        /// @return Text to show while the children of an expanded item aren't available yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const String& getLoadingItemText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until the children that are being loaded in the background are available and adds them to their items
+        ///
+        /// Children loaded in the background are normally added during updateTime(). This function can be used when the
+        /// children are needed immediately, e.g. before saving the tree view or when testing the loader.
+        ///
+        /// Loads that failed are treated the same as in updateTime(): the placeholder item remains until the item is expanded
+        /// again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForChildLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a handle to an item
+        ///
+        /// @param hierarchy  Hierarchy of items, identifying the node
+        ///
+        /// @return Handle to the item, or an invalid handle if the hierarchy doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ItemHandle getItemHandle(const std::vector<String>& hierarchy) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a handle to the selected item
+        /// @return Handle to the selected item, or an invalid handle when no item was selected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ItemHandle getSelectedItemHandle() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Expands the item that the handle refers to, together with all its parents
+        ///
+        /// @param item  Handle to the item to expand
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void expand(const ItemHandle& item);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Collapses the item that the handle refers to
+        ///
+        /// @param item  Handle to the item to collapse
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collapse(const ItemHandle& item);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Selects the item that the handle refers to
+        ///
+        /// @param item  Handle to the item to select
+        ///
+        /// @return True when the item was selected, false when the item no longer exists
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool selectItem(const ItemHandle& item);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the item that the handle refers to
+        ///
+        /// @param item  Handle to the item to remove
+        /// @param removeParentsWhenEmpty  Also delete the parent of the deleted item if it has no other children
+        ///
+        /// @return True when the item was removed, false when it no longer existed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeItem(const ItemHandle& item, bool removeParentsWhenEmpty = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the tree view
         /// @param itemHeight  The size of a single item in the tree view
@@ -450,6 +643,78 @@ TGUI_MODULE_EXPORT namespace tgui
         bool expandOrCollapse(const std::vector<String>& hierarchy, bool expand);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Expands (together with its parents) or collapses a node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void expandOrCollapseNode(Node* node, bool expand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Selects a node, which must have been made visible before calling this function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool selectVisibleNode(const Node* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the node in the list of visible nodes, or -1 if it isn't visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD int findVisibleNodeIndex(const Node* node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Requests the children of a lazy node from the child loader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadChildren(Node* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the children returned by the child loader to a node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLoadedChildren(Node* node, const std::vector<LoadedChild>& children);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the children that were loaded in the background to their nodes. Returns whether any node was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool finishBackgroundLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the hierarchy to the child loader on the worker thread, which is created when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::future<std::vector<LoadedChild>> startBackgroundLoad(std::vector<String> hierarchy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts the visible descendants of a node that was just expanded after it in the list of visible nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void showChildNodes(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the descendants of a node that was just collapsed from the list of visible nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void hideChildNodes(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the nodes to the list of visible nodes, together with the descendants of expanded nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collectVisibleNodes(const std::vector<std::shared_ptr<Node>>& nodes, std::vector<std::shared_ptr<Node>>& visibleNodes, float textPadding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the text of a node within its row and updates the width needed to show all visible texts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void positionNodeText(Node& node, float textPadding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars after the visible nodes changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbars();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Helper function to load the items from a text file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,6 +745,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateSelectedItem(int item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the node that the handle refers to, or nullptr if the handle is invalid or belongs to another tree view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<Node> getNodeFromHandle(const ItemHandle& item) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -495,6 +766,51 @@ TGUI_MODULE_EXPORT namespace tgui
         // This contains the nodes of the tree
         std::vector<std::shared_ptr<Node>> m_nodes;
         std::vector<std::shared_ptr<Node>> m_visibleNodes;
+        std::unordered_map<String, std::shared_ptr<Node>, priv::StringHash> m_rootNodesByText;
+
+        // When the loader threw an exception, the children future is no longer valid and the entry is kept until the node
+        // is expanded again, so that the load can be retried while the placeholder remains visible.
+        struct BackgroundLoad
+        {
+            std::weak_ptr<Node> node;
+            std::weak_ptr<Node> placeholder;
+            std::future<std::vector<LoadedChild>> children;
+        };
+
+        // Calls the child loader on a single worker thread, one node at a time. The thread is joined on destruction.
+        class ChildLoadWorker
+        {
+        public:
+            ChildLoadWorker();
+            ~ChildLoadWorker();
+
+            ChildLoadWorker(const ChildLoadWorker&) = delete;
+            ChildLoadWorker& operator=(const ChildLoadWorker&) = delete;
+
+            std::future<std::vector<LoadedChild>> load(ChildLoader loader, std::vector<String> hierarchy);
+
+        private:
+            void run();
+
+            struct Job
+            {
+                ChildLoader loader;
+                std::vector<String> hierarchy;
+                std::promise<std::vector<LoadedChild>> promise;
+            };
+
+            std::mutex m_mutex;
+            std::condition_variable m_jobAvailable;
+            std::deque<Job> m_jobs;
+            bool m_stopping = false;
+            std::thread m_thread;
+        };
+
+        ChildLoader m_childLoader;
+        bool m_loadChildrenInBackground = false;
+        String m_loadingItemText = "Loading...";
+        std::vector<BackgroundLoad> m_backgroundLoads;
+        std::unique_ptr<ChildLoadWorker> m_childLoadWorker;
 
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
@@ -46,7 +46,9 @@ namespace tgui
 
     BackendFont::BackendFont(const BackendFont& other) :
         m_isSmooth(other.m_isSmooth),
-        m_fontScale(other.m_fontScale)
+        m_distanceFieldEnabled(other.m_distanceFieldEnabled),
+        m_fontScale(other.m_fontScale),
+        m_glyphCacheDirectory(other.m_glyphCacheDirectory)
     {
         TGUI_ASSERT(isBackendSet(), "Backend must exist before creating a font");
         getBackend()->registerFont(this);
@@ -56,7 +58,9 @@ namespace tgui
 
     BackendFont::BackendFont(BackendFont&& other) noexcept :
         m_isSmooth(std::move(other.m_isSmooth)),
-        m_fontScale(std::move(other.m_fontScale))
+        m_distanceFieldEnabled(std::move(other.m_distanceFieldEnabled)),
+        m_fontScale(std::move(other.m_fontScale)),
+        m_glyphCacheDirectory(std::move(other.m_glyphCacheDirectory))
     {
         TGUI_ASSERT(isBackendSet(), "Backend must exist before creating a font");
         getBackend()->registerFont(this);
@@ -77,7 +81,9 @@ namespace tgui
         if (this != &other)
         {
             m_isSmooth = other.m_isSmooth;
+            m_distanceFieldEnabled = other.m_distanceFieldEnabled;
             m_fontScale = other.m_fontScale;
+            m_glyphCacheDirectory = other.m_glyphCacheDirectory;
         }
 
         return *this;
@@ -90,7 +96,9 @@ namespace tgui
         if (this != &other)
         {
             m_isSmooth = std::move(other.m_isSmooth);
+            m_distanceFieldEnabled = std::move(other.m_distanceFieldEnabled);
             m_fontScale = std::move(other.m_fontScale);
+            m_glyphCacheDirectory = std::move(other.m_glyphCacheDirectory);
         }
 
         return *this;
@@ -148,6 +156,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendFont::setDistanceFieldEnabled(bool)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFont::isDistanceFieldEnabled() const
+    {
+        return m_distanceFieldEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFont::getDistanceFieldMaxOutlineThickness(unsigned int characterSize)
+    {
+        return static_cast<float>(DistanceFieldSpread * characterSize) / DistanceFieldReferenceSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::preload(const String& characters, const std::vector<unsigned int>& characterSizes, TextStyles style)
+    {
+        const bool bold = (static_cast<unsigned int>(style) & TextStyle::Bold) != 0;
+        for (const unsigned int characterSize : characterSizes)
+        {
+            for (const char32_t codePoint : characters)
+                (void)getGlyph(codePoint, characterSize, bold);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFont::isPreloading() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::setGlyphCacheDirectory(const String& directory)
+    {
+        m_glyphCacheDirectory = directory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& BackendFont::getGlyphCacheDirectory() const
+    {
+        return m_glyphCacheDirectory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setFontScale(float scale)
     {
         if (scale == m_fontScale)
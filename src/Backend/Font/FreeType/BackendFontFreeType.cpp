@@ -46,7 +46,19 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <atomic>
     #include <cmath>
+    #include <cstdio>
+    #include <fstream>
+    #include <iterator>
+    #include <vector>
+#endif
+
+#ifdef TGUI_SYSTEM_WINDOWS
+    #include <TGUI/extlibs/IncludeWindows.hpp>
+#else
+    #include <unistd.h> // getpid
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,54 +67,131 @@ namespace tgui
 {
     static const float unitsPerPixel = 64; // Freetype's 26.6 pixel format uses 1/64th of a pixel as unit
 
+    static const std::uint32_t glyphCacheMagic = 0x54475946; // "TGYF"
+    static const std::uint32_t glyphCacheVersion = 1;
+    static const std::uint64_t glyphCacheMaxFileSize = 64 * 1024 * 1024; // Larger files are considered corrupt and are ignored
+    static std::atomic<std::uint32_t> glyphCacheTempFileCounter{0}; // Gives each temporary cache file in this process its own name
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::~BackendFontFreetype()
+    // Computes a 64-bit FNV-1a hash of the font file, which is used to name the glyph cache file
+    TGUI_NODISCARD static std::uint64_t hashFileContents(const std::uint8_t* data, std::size_t size)
     {
-        cleanup();
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
+    TGUI_NODISCARD static String getGlyphCacheFilename(std::uint64_t fileHash, bool distanceField)
     {
-        cleanup();
-        m_cachedLineSpacing.clear();
-        m_cachedFontHeights.clear();
-        m_cachedAscents.clear();
-        m_cachedDescents.clear();
-        m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
-        m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
+        static const char hexDigits[] = "0123456789abcdef";
+        std::string hashStr(16, '0');
+        for (std::size_t i = 0; i < 16; ++i)
+            hashStr[15 - i] = hexDigits[(fileHash >> (4 * i)) & 0xF];
 
-        constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
+        return U"tgui-glyphs-" + String(hashStr) + (distanceField ? U"-sdf.bin" : U".bin");
+    }
 
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The glyph cache file is only read on the machine that wrote it, so values are stored in their native byte order
+    template <typename T>
+    TGUI_NODISCARD static bool readValues(std::ifstream& file, T* values, std::size_t count)
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(values), static_cast<std::streamsize>(sizeof(T) * count)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    static void writeValues(std::ofstream& file, const T* values, std::size_t count)
+    {
+        file.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(sizeof(T) * count));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Stores the signed distance to the edge of the glyph in the alpha image, for every pixel of the glyph and for the
+    // pixels around it up to DistanceFieldSpread pixels away. The glyph starts at the padding offset within the image.
+    static void writeDistanceField(const FT_Bitmap& bitmap, std::uint8_t* alpha, unsigned int imageWidth, unsigned int padding)
+    {
+        const int spread = static_cast<int>(BackendFont::DistanceFieldSpread);
+        const int width = static_cast<int>(bitmap.width);
+        const int height = static_cast<int>(bitmap.rows);
+
+        // Find out which pixels lie inside the glyph
+        std::vector<std::uint8_t> inside(static_cast<std::size_t>(width * height));
+        for (int y = 0; y < height; ++y)
         {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
+            for (int x = 0; x < width; ++x)
             {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
+                if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                    inside[static_cast<std::size_t>(y * width + x)] = (bitmap.buffer[(y * bitmap.pitch) + (x / 8)] & (1 << (7 - (x % 8)))) ? 1 : 0;
+                else
+                    inside[static_cast<std::size_t>(y * width + x)] = (bitmap.buffer[(y * bitmap.pitch) + x] >= 128) ? 1 : 0;
             }
         }
 
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
+        const auto isInside = [&](int x, int y){
+            if ((x < 0) || (y < 0) || (x >= width) || (y >= height))
+                return false;
+            return inside[static_cast<std::size_t>(y * width + x)] != 0;
+        };
+
+        // For every pixel, search the nearest pixel on the other side of the edge
+        for (int y = -spread; y < height + spread; ++y)
         {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
+            for (int x = -spread; x < width + spread; ++x)
+            {
+                const bool pixelInside = isInside(x, y);
+                int minDistanceSquared = (spread + 1) * (spread + 1);
+                for (int dy = -spread; dy <= spread; ++dy)
+                {
+                    for (int dx = -spread; dx <= spread; ++dx)
+                    {
+                        if ((isInside(x + dx, y + dy) != pixelInside) && (dx * dx + dy * dy < minDistanceSquared))
+                            minDistanceSquared = dx * dx + dy * dy;
+                    }
+                }
+
+                // The edge lies halfway between the pixel centers
+                const float distance = std::min(std::sqrt(static_cast<float>(minDistanceSquared)) - 0.5f, static_cast<float>(spread));
+                const float signedDistance = pixelInside ? distance : -distance;
+                const float value = 0.5f + (signedDistance / (2.f * spread));
+
+                // The padding is larger than the spread, so the pixel position can't become negative
+                const std::size_t index = static_cast<std::size_t>(static_cast<int>(padding) + x)
+                                        + static_cast<std::size_t>(static_cast<int>(padding) + y) * imageWidth;
+                alpha[index] = static_cast<std::uint8_t>(std::max(0.f, std::min(value, 1.f)) * 255.f + 0.5f);
+            }
         }
+    }
 
-        m_textureSize = initialTextureSize;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::~BackendFontFreetype()
+    {
+        cleanup();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
+    {
+        cleanup();
+        m_cachedLineSpacing.clear();
+        m_cachedFontHeights.clear();
+        m_cachedAscents.clear();
+        m_cachedDescents.clear();
+        m_textureVersion = 0;
+        resetGlyphs();
 
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
@@ -125,7 +214,15 @@ namespace tgui
             throw Exception{U"Failed to select font character map"};
         }
 
+        // Bitmap fonts can't be rasterized at the reference size of the distance field mode
+        if (m_distanceFieldEnabled && !FT_IS_SCALABLE(face))
+        {
+            TGUI_PRINT_WARNING("distance field mode was disabled because the font isn't scalable");
+            m_distanceFieldEnabled = false;
+        }
+
         m_fileContents = std::move(data);
+        m_fileSize = sizeInBytes;
         m_library = library;
         m_face = face;
         return true;
@@ -307,14 +404,18 @@ namespace tgui
 
     std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
     {
+        // Glyphs that finished loading in the background are added before the text is drawn
+        publishPreloadedGlyphs();
+
         if (m_texture)
         {
             textureVersion = m_textureVersion;
             return m_texture;
         }
 
+        // Distance fields need linear filtering to interpolate between the distances
         m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth || m_distanceFieldEnabled);
 
         textureVersion = ++m_textureVersion;
         return m_texture;
@@ -333,7 +434,72 @@ namespace tgui
     {
         BackendFont::setSmooth(smooth);
         if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
+            m_texture->setSmooth(m_isSmooth || m_distanceFieldEnabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setDistanceFieldEnabled(bool enabled)
+    {
+        if (m_distanceFieldEnabled == enabled)
+            return;
+
+        if (enabled && m_face && !FT_IS_SCALABLE(m_face))
+        {
+            TGUI_PRINT_WARNING("distance field mode can't be enabled because the font isn't scalable");
+            return;
+        }
+
+        m_distanceFieldEnabled = enabled;
+
+        // The glyphs that were already loaded are stored in the wrong format, so they all have to be loaded again
+        resetGlyphs();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::preload(const String& characters, const std::vector<unsigned int>& characterSizes, TextStyles style)
+    {
+        if (!m_face || characters.empty() || characterSizes.empty())
+            return;
+
+        PreloadRequest request;
+        request.characters = std::u32string(characters);
+        request.bold = (static_cast<unsigned int>(style) & TextStyle::Bold) != 0;
+        request.distanceField = m_distanceFieldEnabled;
+        request.cacheDirectory = m_glyphCacheDirectory;
+
+        // In distance field mode, all character sizes share the same glyphs
+        if (request.distanceField)
+            request.pixelSizes.push_back(DistanceFieldReferenceSize);
+        else
+        {
+            for (const unsigned int characterSize : characterSizes)
+                request.pixelSizes.push_back(static_cast<unsigned int>(characterSize * m_fontScale));
+        }
+
+        std::lock_guard<std::mutex> lock(m_preloadMutex);
+        request.glyphGeneration = m_glyphGeneration;
+        m_preloadRequests.push_back(std::move(request));
+
+        // Start a new thread if the previous one already finished its work. The old thread has to be joined first, but
+        // this won't block for long as it no longer accesses the requests after marking itself as no longer running.
+        if (!m_preloadThreadRunning)
+        {
+            if (m_preloadThread.joinable())
+                m_preloadThread.join();
+
+            m_preloadThreadRunning = true;
+            m_preloadThread = std::thread(&BackendFontFreetype::runPreloadThread, this);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isPreloading() const
+    {
+        std::lock_guard<std::mutex> lock(m_preloadMutex);
+        return m_preloadThreadRunning;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -353,12 +519,35 @@ namespace tgui
 
     BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
-        Glyph glyph;
         if (!m_face)
-            return glyph;
+            return {};
 
-        if (!setCurrentSize(characterSize))
-            return glyph;
+        // In distance field mode, glyphs are always rasterized at the same size and outlines are created by the shader
+        const bool distanceField = m_distanceFieldEnabled;
+        if (distanceField)
+        {
+            if (!setCurrentPixelSize(DistanceFieldReferenceSize))
+                return {};
+
+            outlineThickness = 0;
+        }
+        else if (!setCurrentSize(characterSize))
+            return {};
+
+        // Create the stroker if this is the first time an outline was requested with this font
+        if ((outlineThickness != 0) && !m_stroker)
+            FT_Stroker_New(m_library, &m_stroker);
+
+        RasterizedGlyph rasterizedGlyph;
+        rasterizeGlyph(m_library, m_face, m_stroker, codePoint, bold, outlineThickness * m_fontScale, distanceField, rasterizedGlyph);
+        return addGlyphToTexture(rasterizedGlyph);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker stroker, char32_t codePoint, bool bold,
+                                             float outlineThickness, bool distanceField, RasterizedGlyph& rasterizedGlyph)
+    {
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -370,26 +559,19 @@ namespace tgui
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
-        if (FT_Load_Char(m_face, codePoint, flags) != 0)
-            return glyph;
+        if (FT_Load_Char(face, codePoint, flags) != 0)
+            return;
 
         // Retrieve the glyph
         FT_Glyph glyphDesc;
-        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
-            return glyph;
+        if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+            return;
 
         // Add an outline if requested and the font supports it
-        if ((outlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
+        if ((outlineThickness != 0) && stroker && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
         {
-            // Create the stroker if this is the first time an outline was requested with this font
-            if (!m_stroker)
-                FT_Stroker_New(m_library, &m_stroker);
-
-            if (m_stroker)
-            {
-                FT_Stroker_Set(m_stroker, static_cast<FT_Fixed>(outlineThickness * m_fontScale * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-                FT_Glyph_Stroke(&glyphDesc, m_stroker, true);
-            }
+            FT_Stroker_Set(stroker, static_cast<FT_Fixed>(outlineThickness * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
         }
 
         // Apply the bold style if requested and outlines are supported
@@ -406,7 +588,7 @@ namespace tgui
         if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
         {
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return;
         }
         FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
         FT_Bitmap& bitmap = bitmapGlyph->bitmap;
@@ -414,15 +596,16 @@ namespace tgui
         // If bold was requested but the font didn't support outlines then apply bold here using a different (lower quality) method
         // We have to cache the outline support bool because FT_Glyph_To_Bitmap changes format to FT_GLYPH_FORMAT_BITMAP.
         if (bold && !outlineSupport)
-            FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, boldWeight, boldWeight);
+            FT_Bitmap_Embolden(library, &bitmap, boldWeight, boldWeight);
 
         // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
+        Glyph& glyph = rasterizedGlyph.glyph;
         glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
         if (bold)
             glyph.advance += static_cast<float>(boldWeight) / unitsPerPixel;
 
-        glyph.lsbDelta = static_cast<float>(m_face->glyph->lsb_delta);
-        glyph.rsbDelta = static_cast<float>(m_face->glyph->rsb_delta);
+        glyph.lsbDelta = static_cast<float>(face->glyph->lsb_delta);
+        glyph.rsbDelta = static_cast<float>(face->glyph->rsb_delta);
 
         // Compute the glyph's bounding box
         glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
@@ -434,30 +617,30 @@ namespace tgui
         {
             // This branch will e.g. be executed when loading a space character. The glyph will have an advance but no bitmap.
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return;
         }
 
-        // Find a good position for the new glyph into the texture.
         // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
-        const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
-        glyph.textureRect.left += padding;
-        glyph.textureRect.top += padding;
-        glyph.textureRect.width -= 2 * padding;
-        glyph.textureRect.height -= 2 * padding;
+        // Distance fields also need room to store the distances outside the glyph.
+        const unsigned int padding = distanceField ? (DistanceFieldSpread + 1) : 2;
+        rasterizedGlyph.padding = padding;
+        rasterizedGlyph.imageWidth = bitmap.width + (2 * padding);
+        rasterizedGlyph.imageHeight = bitmap.rows + (2 * padding);
+        rasterizedGlyph.alpha.assign(static_cast<std::size_t>(rasterizedGlyph.imageWidth) * rasterizedGlyph.imageHeight, 0);
 
         // Extract the glyph's pixels from the bitmap
         const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        if (distanceField)
+            writeDistanceField(bitmap, rasterizedGlyph.alpha.data(), rasterizedGlyph.imageWidth, padding);
+        else if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
             // Pixels are 1 bit monochrome values
             for (unsigned int y = 0; y < bitmap.rows; ++y)
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+                    const std::size_t index = (padding + x) + (padding + y) * rasterizedGlyph.imageWidth;
+                    rasterizedGlyph.alpha[index] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
                 }
             }
         }
@@ -468,28 +651,318 @@ namespace tgui
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
+                    const std::size_t index = (padding + x) + (padding + y) * rasterizedGlyph.imageWidth;
+                    rasterizedGlyph.alpha[index] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
                 }
             }
         }
 
+        FT_Done_Glyph(glyphDesc);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::addGlyphToTexture(const RasterizedGlyph& rasterizedGlyph)
+    {
+        Glyph glyph = rasterizedGlyph.glyph;
+        if (rasterizedGlyph.alpha.empty())
+            return glyph;
+
+        // Find a good position for the new glyph into the texture
+        const unsigned int padding = rasterizedGlyph.padding;
+        const UIntRect imageRect = findAvailableGlyphRect(rasterizedGlyph.imageWidth, rasterizedGlyph.imageHeight);
+        glyph.textureRect = {imageRect.left + padding, imageRect.top + padding, imageRect.width - 2 * padding, imageRect.height - 2 * padding};
+
+        // The color channels remain white, just fill the alpha channel
+        for (unsigned int y = 0; y < rasterizedGlyph.imageHeight; ++y)
+        {
+            for (unsigned int x = 0; x < rasterizedGlyph.imageWidth; ++x)
+            {
+                const std::size_t index = (imageRect.left + x) + (imageRect.top + y) * m_textureSize;
+                m_pixels[index * 4 + 3] = rasterizedGlyph.alpha[x + y * rasterizedGlyph.imageWidth];
+            }
+        }
+
         // We will have to recreate the texture now that the pixels changed
         m_texture = nullptr;
-
-        FT_Done_Glyph(glyphDesc);
         return glyph;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendFontFreetype::publishPreloadedGlyphs()
+    {
+        std::vector<RasterizedGlyph> preloadedGlyphs;
+        {
+            std::lock_guard<std::mutex> lock(m_preloadMutex);
+            if (m_preloadedGlyphs.empty())
+                return;
+
+            preloadedGlyphs.swap(m_preloadedGlyphs);
+        }
+
+        for (const auto& rasterizedGlyph : preloadedGlyphs)
+        {
+            // The glyph may have been loaded in the meantime because it was needed before the preload thread finished it
+            if (m_glyphs.find(rasterizedGlyph.key) == m_glyphs.end())
+                m_glyphs.insert({rasterizedGlyph.key, addGlyphToTexture(rasterizedGlyph)});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::runPreloadThread()
+    {
+        // Freetype faces can't be shared between threads, so this thread creates its own face from the same font file
+        FT_Library library = nullptr;
+        FT_Face face = nullptr;
+        if ((FT_Init_FreeType(&library) != 0)
+         || (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(m_fileContents.get()), static_cast<FT_Long>(m_fileSize), 0, &face) != 0)
+         || (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0))
+        {
+            face = nullptr;
+        }
+
+        std::uint64_t fileHash = 0;
+        while (true)
+        {
+            PreloadRequest request;
+            {
+                std::lock_guard<std::mutex> lock(m_preloadMutex);
+                if (!face || m_preloadRequests.empty() || m_preloadCancelled)
+                {
+                    m_preloadRequests.clear();
+                    m_preloadThreadRunning = false;
+                    break;
+                }
+
+                request = std::move(m_preloadRequests.front());
+                m_preloadRequests.pop_front();
+            }
+
+            // Glyphs that were already rasterized in a previous run of the program can be read from the cache file
+            Filesystem::Path cacheFilename;
+            std::unordered_map<std::uint64_t, RasterizedGlyph> cachedGlyphs;
+            if (!request.cacheDirectory.empty())
+            {
+                if (fileHash == 0)
+                    fileHash = hashFileContents(m_fileContents.get(), m_fileSize);
+
+                cacheFilename = Filesystem::Path(request.cacheDirectory) / getGlyphCacheFilename(fileHash, request.distanceField);
+                (void)readGlyphCache(cacheFilename, cachedGlyphs);
+            }
+
+            bool cacheChanged = false;
+            for (const unsigned int pixelSize : request.pixelSizes)
+            {
+                if (FT_Set_Pixel_Sizes(face, 0, pixelSize) != FT_Err_Ok)
+                    continue;
+
+                std::vector<RasterizedGlyph> glyphs;
+                for (const char32_t codePoint : request.characters)
+                {
+                    if (m_preloadCancelled)
+                        break;
+
+                    const std::uint64_t glyphKey = constructGlyphKey(codePoint, pixelSize, request.bold, 0);
+                    auto it = cachedGlyphs.find(glyphKey);
+                    if (it == cachedGlyphs.end())
+                    {
+                        RasterizedGlyph rasterizedGlyph;
+                        rasterizedGlyph.key = glyphKey;
+                        rasterizeGlyph(library, face, nullptr, codePoint, request.bold, 0, request.distanceField, rasterizedGlyph);
+                        it = cachedGlyphs.insert({glyphKey, std::move(rasterizedGlyph)}).first;
+                        cacheChanged = true;
+                    }
+
+                    glyphs.push_back(it->second);
+                }
+
+                // Hand the glyphs over to the main thread. They are discarded if the texture was reset in the meantime.
+                std::lock_guard<std::mutex> lock(m_preloadMutex);
+                if (request.glyphGeneration == m_glyphGeneration)
+                    m_preloadedGlyphs.insert(m_preloadedGlyphs.end(), std::make_move_iterator(glyphs.begin()), std::make_move_iterator(glyphs.end()));
+            }
+
+            if (cacheChanged && !cacheFilename.isEmpty() && !m_preloadCancelled && !writeGlyphCache(cacheFilename, cachedGlyphs))
+            {
+                TGUI_PRINT_WARNING(U"failed to write glyph cache file '" + cacheFilename.asString() + U"'");
+            }
+        }
+
+        if (face)
+            FT_Done_Face(face);
+        if (library)
+            FT_Done_FreeType(library);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::stopPreloading()
+    {
+        m_preloadCancelled = true;
+        if (m_preloadThread.joinable())
+            m_preloadThread.join();
+
+        m_preloadCancelled = false;
+        m_preloadRequests.clear();
+        m_preloadedGlyphs.clear();
+        m_preloadThreadRunning = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::readGlyphCache(const Filesystem::Path& filename, std::unordered_map<std::uint64_t, RasterizedGlyph>& glyphs)
+    {
+        std::ifstream file(filename.asNativeString(), std::ios::binary | std::ios::ate);
+        if (!file)
+            return false;
+
+        // Nothing that is read from the file can make us allocate more memory than the size of the file itself
+        const std::streamoff fileSize = file.tellg();
+        if ((fileSize < 0) || (static_cast<std::uint64_t>(fileSize) > glyphCacheMaxFileSize) || !file.seekg(0))
+            return false;
+
+        std::uint32_t header[3];
+        if (!readValues(file, header, 3) || (header[0] != glyphCacheMagic) || (header[1] != glyphCacheVersion))
+            return false;
+
+        // Each glyph stores at least its key, metrics and image info, so a larger glyph count can't be correct
+        const std::size_t minGlyphSize = sizeof(std::uint64_t) + (7 * sizeof(float)) + (3 * sizeof(std::uint32_t));
+        std::uint64_t remainingSize = static_cast<std::uint64_t>(fileSize) - sizeof(header);
+        if (header[2] > remainingSize / minGlyphSize)
+            return false;
+
+        for (std::uint32_t i = 0; i < header[2]; ++i)
+        {
+            RasterizedGlyph rasterizedGlyph;
+            float metrics[7];
+            std::uint32_t imageInfo[3];
+            if (!readValues(file, &rasterizedGlyph.key, 1) || !readValues(file, metrics, 7) || !readValues(file, imageInfo, 3))
+                return false;
+
+            // Reject images that are too large or don't have room for their padding, the file is probably corrupt
+            if ((imageInfo[0] > 4096) || (imageInfo[1] > 4096) || ((imageInfo[0] * imageInfo[1] != 0)
+             && ((2 * imageInfo[2] >= imageInfo[0]) || (2 * imageInfo[2] >= imageInfo[1]))))
+                return false;
+
+            remainingSize -= minGlyphSize;
+            const std::uint64_t imageSize = static_cast<std::uint64_t>(imageInfo[0]) * imageInfo[1];
+            if (imageSize > remainingSize)
+                return false;
+
+            remainingSize -= imageSize;
+
+            rasterizedGlyph.glyph.advance = metrics[0];
+            rasterizedGlyph.glyph.lsbDelta = metrics[1];
+            rasterizedGlyph.glyph.rsbDelta = metrics[2];
+            rasterizedGlyph.glyph.bounds = {metrics[3], metrics[4], metrics[5], metrics[6]};
+            rasterizedGlyph.imageWidth = imageInfo[0];
+            rasterizedGlyph.imageHeight = imageInfo[1];
+            rasterizedGlyph.padding = imageInfo[2];
+            rasterizedGlyph.alpha.resize(static_cast<std::size_t>(imageSize));
+            if (!readValues(file, rasterizedGlyph.alpha.data(), rasterizedGlyph.alpha.size()))
+                return false;
+
+            glyphs[rasterizedGlyph.key] = std::move(rasterizedGlyph);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::writeGlyphCache(const Filesystem::Path& filename, const std::unordered_map<std::uint64_t, RasterizedGlyph>& glyphs)
+    {
+        // Don't write a file that readGlyphCache would reject
+        const std::size_t glyphHeaderSize = sizeof(std::uint64_t) + (7 * sizeof(float)) + (3 * sizeof(std::uint32_t));
+        std::uint64_t fileSize = 3 * sizeof(std::uint32_t);
+        for (const auto& pair : glyphs)
+            fileSize += glyphHeaderSize + pair.second.alpha.size();
+        if (fileSize > glyphCacheMaxFileSize)
+            return false;
+
+        // The file is written under a temporary name and only replaces the old file once it is complete, so that another
+        // program that uses the same cache directory never reads a partially written file. The process id and a counter
+        // make the temporary name unique, so that fonts that are written at the same time don't write to the same file.
+#ifdef TGUI_SYSTEM_WINDOWS
+        const unsigned long processId = GetCurrentProcessId();
+#else
+        const unsigned long processId = static_cast<unsigned long>(getpid());
+#endif
+        const Filesystem::Path tempFilename(filename.asString() + U"." + String::fromNumber(processId) + U"-"
+                                            + String::fromNumber(++glyphCacheTempFileCounter) + U".tmp");
+        std::ofstream file(tempFilename.asNativeString(), std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        const std::uint32_t header[3] = {glyphCacheMagic, glyphCacheVersion, static_cast<std::uint32_t>(glyphs.size())};
+        writeValues(file, header, 3);
+        for (const auto& pair : glyphs)
+        {
+            const RasterizedGlyph& rasterizedGlyph = pair.second;
+            const Glyph& glyph = rasterizedGlyph.glyph;
+            const float metrics[7] = {glyph.advance, glyph.lsbDelta, glyph.rsbDelta,
+                                      glyph.bounds.left, glyph.bounds.top, glyph.bounds.width, glyph.bounds.height};
+            const std::uint32_t imageInfo[3] = {rasterizedGlyph.imageWidth, rasterizedGlyph.imageHeight, rasterizedGlyph.padding};
+            writeValues(file, &rasterizedGlyph.key, 1);
+            writeValues(file, metrics, 7);
+            writeValues(file, imageInfo, 3);
+            writeValues(file, rasterizedGlyph.alpha.data(), rasterizedGlyph.alpha.size());
+        }
+
+        file.close();
+#ifdef TGUI_SYSTEM_WINDOWS
+        if (file && (MoveFileExW(tempFilename.asNativeString().c_str(), filename.asNativeString().c_str(), MOVEFILE_REPLACE_EXISTING) != 0))
+            return true;
+
+        (void)DeleteFileW(tempFilename.asNativeString().c_str());
+#else
+        if (file && (std::rename(tempFilename.asNativeString().c_str(), filename.asNativeString().c_str()) == 0))
+            return true;
+
+        (void)std::remove(tempFilename.asNativeString().c_str());
+#endif
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
+        if (m_distanceFieldEnabled)
+        {
+            // The same glyph is used for all sizes and outline thicknesses, only its metrics need to be scaled
+            const std::uint64_t glyphKey = constructGlyphKey(codePoint, DistanceFieldReferenceSize, bold, 0);
+
+            auto it = m_glyphs.find(glyphKey);
+            if (it == m_glyphs.end())
+            {
+                publishPreloadedGlyphs();
+                it = m_glyphs.find(glyphKey);
+                if (it == m_glyphs.end())
+                    it = m_glyphs.insert({glyphKey, loadGlyph(codePoint, characterSize, bold, 0)}).first;
+            }
+
+            const float scale = (characterSize * m_fontScale) / DistanceFieldReferenceSize;
+            Glyph glyph = it->second;
+            glyph.advance *= scale;
+            glyph.lsbDelta *= scale;
+            glyph.rsbDelta *= scale;
+            glyph.bounds = {glyph.bounds.getPosition() * scale, glyph.bounds.getSize() * scale};
+            return glyph;
+        }
+
         const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
                                                          bold, outlineThickness * m_fontScale);
 
-        const auto it = m_glyphs.find(glyphKey);
+        auto it = m_glyphs.find(glyphKey);
+        if (it != m_glyphs.end())
+            return it->second;
+
+        // The glyph might have been loaded by the preload thread
+        publishPreloadedGlyphs();
+        it = m_glyphs.find(glyphKey);
         if (it != m_glyphs.end())
             return it->second;
 
@@ -584,19 +1057,69 @@ namespace tgui
 
     bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+        return setCurrentPixelSize(static_cast<unsigned int>(characterSize * m_fontScale));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendFontFreetype::setCurrentPixelSize(unsigned int pixelSize)
+    {
         // Don't call FT_Set_Pixel_Sizes if we don't have to
-        if (scaledCharacterSize == m_face->size->metrics.x_ppem)
+        if (pixelSize == m_face->size->metrics.x_ppem)
             return true;
 
-        return (FT_Set_Pixel_Sizes(m_face, 0, scaledCharacterSize) == FT_Err_Ok);
+        return (FT_Set_Pixel_Sizes(m_face, 0, pixelSize) == FT_Err_Ok);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::resetGlyphs()
+    {
+        {
+            // Glyphs that are still being preloaded no longer match the texture
+            std::lock_guard<std::mutex> lock(m_preloadMutex);
+            m_preloadedGlyphs.clear();
+            ++m_glyphGeneration;
+        }
+
+        m_glyphs.clear();
+        m_rows.clear();
+        m_texture = nullptr;
+        m_nextRow = 3; // First 2 rows contain pixels for underlining
+
+        constexpr unsigned int initialTextureSize = 128;
+        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
+
+        std::uint8_t* pixelPtr = m_pixels.get();
+        for (unsigned int y = 0; y < initialTextureSize; ++y)
+        {
+            for (unsigned int x = 0; x < initialTextureSize; ++x)
+            {
+                // Color is always white, alpha channel contains whether the pixel is empty of not
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 0;
+            }
+        }
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
+        }
+
+        m_textureSize = initialTextureSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendFontFreetype::cleanup()
     {
+        // The preload thread uses the font data, so it has to be stopped before the font changes
+        stopPreloading();
+
         if (m_stroker)
             FT_Stroker_Done(m_stroker);
 
@@ -27,10 +27,10 @@
 #include <TGUI/Backend/Renderer/BackendText.hpp>
 #include <TGUI/Widget.hpp>
 
-#include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <array>
     #include <cmath>
+    #include <tuple>
 
     #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
         #include <numbers>
@@ -43,134 +43,114 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawCircleHelperGetPoints(unsigned int nrPoints, float radius, float offset)
+    // Fills the points vector with the points on a circle, based on the coordinates of the points on a circle with radius 1
+    static void getCirclePoints(std::vector<Vector2f>& points, const std::vector<Vector2f>& unitCirclePoints, float radius, float offset)
     {
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
-        points.reserve(nrPoints);
-
-        for (unsigned int i = 0; i < nrPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * i / nrPoints)),
-                                offset + radius + (radius * std::sin(twoPi * i / nrPoints)));
-        }
-
-        return points;
+        points.clear();
+        points.reserve(unitCirclePoints.size());
+        for (const auto& unitPoint : unitCirclePoints)
+            points.emplace_back(offset + radius + (radius * unitPoint.x), offset + radius + (radius * unitPoint.y));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawRoundedRectHelperGetPoints(unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
+    // Fills the points vector with the points on the corners of a rounded rectangle.
+    // The unit circle has to contain 4*(nrCornerPoints-1) points, or a single point when nrCornerPoints is 1.
+    static void getRoundedRectPoints(std::vector<Vector2f>& points, const std::vector<Vector2f>& unitCirclePoints,
+                                     unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
     {
-        assert(nrCornerPoints != 0);
+        TGUI_ASSERT(nrCornerPoints != 0, "Rounded rectangle needs at least one point per corner");
 
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
+        points.clear();
         points.reserve(nrCornerPoints * 4);
 
-        const unsigned int nrPointsInCircle = 4 * (nrCornerPoints - 1);
+        const std::size_t nrPointsInCircle = unitCirclePoints.size();
+        const auto getUnitPoint = [&](unsigned int corner, unsigned int i) -> const Vector2f& {
+            return unitCirclePoints[(corner * (nrCornerPoints - 1) + i) % nrPointsInCircle];
+        };
 
         // Top right corner
         for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * i / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * i / nrPointsInCircle)));
-        }
+            points.emplace_back(offset + size.x - radius + (radius * getUnitPoint(0, i).x), offset + radius - (radius * getUnitPoint(0, i).y));
 
         // Top left corner
         for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
+            points.emplace_back(offset + radius + (radius * getUnitPoint(1, i).x), offset + radius - (radius * getUnitPoint(1, i).y));
 
         // Bottom left corner
         for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
+            points.emplace_back(offset + radius + (radius * getUnitPoint(2, i).x), offset + size.y - radius - (radius * getUnitPoint(2, i).y));
 
         // Bottom right corner
         for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
-
-        return points;
+            points.emplace_back(offset + size.x - radius + (radius * getUnitPoint(3, i).x), offset + size.y - radius - (radius * getUnitPoint(3, i).y));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawBordersAroundShape(BackendRenderTarget* renderTarget, const RenderStates& states,
-                                       const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
+    static void addBordersAroundShape(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                                      const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
     {
         TGUI_ASSERT(outerPoints.size() == innerPoints.size(), "Inner and outer ring of cicle border should have the same amount of points");
 
         // Create the vertices
-        std::vector<Vertex> vertices;
-        vertices.reserve(outerPoints.size() + innerPoints.size());
+        const auto firstIndex = static_cast<unsigned int>(vertices.size());
+        const auto nrPoints = static_cast<unsigned int>(outerPoints.size());
+        vertices.reserve(vertices.size() + outerPoints.size() + innerPoints.size());
         for (const auto& point : outerPoints)
             vertices.emplace_back(point, Vertex::Color(color));
         for (const auto& point : innerPoints)
             vertices.emplace_back(point, Vertex::Color(color));
 
-        // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * (outerPoints.size() + innerPoints.size()));
-        for (std::size_t i = 0; i < outerPoints.size(); ++i)
+        // Create the indices. The last two triangles connect back to the first points to close the shape.
+        indices.reserve(indices.size() + 6 * outerPoints.size());
+        for (unsigned int i = 0; i < nrPoints; ++i)
         {
-            indices.push_back(static_cast<unsigned int>(i));
-            indices.push_back(static_cast<unsigned int>(i+1));
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i));
+            const unsigned int next = (i + 1) % nrPoints;
 
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i));
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i+1));
-            indices.push_back(static_cast<unsigned int>(i+1));
-        }
+            indices.push_back(firstIndex + i);
+            indices.push_back(firstIndex + next);
+            indices.push_back(firstIndex + nrPoints + i);
 
-        // The last two triangles were given wrong indices by the loop (where there are "+1" in the code), and need to be overwitten to close the circle
-        indices[indices.size() - 1] = 0;
-        indices[indices.size() - 2] = static_cast<unsigned int>(outerPoints.size());
-        indices[indices.size() - 5] = 0;
-
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
+            indices.push_back(firstIndex + nrPoints + i);
+            indices.push_back(firstIndex + nrPoints + next);
+            indices.push_back(firstIndex + next);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawInnerShape(BackendRenderTarget* renderTarget, const RenderStates& states, const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
+    static void addInnerShape(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                              const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
     {
         // Create the vertices (one point in the middle of the circle and the others as provided in the 'points' parameter)
-        std::vector<Vertex> vertices;
-        vertices.reserve(1 + points.size());
+        const auto firstIndex = static_cast<unsigned int>(vertices.size());
+        const auto nrPoints = static_cast<unsigned int>(points.size());
+        vertices.reserve(vertices.size() + 1 + points.size());
         vertices.emplace_back(centerPoint, Vertex::Color(color));
         for (const auto& point : points)
             vertices.emplace_back(point, Vertex::Color(color));
 
-        // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * points.size());
-        for (std::size_t i = 1; i <= points.size(); ++i)
+        // Create the indices. The last triangle uses the first point again, to close the circle.
+        indices.reserve(indices.size() + 3 * points.size());
+        for (unsigned int i = 1; i <= nrPoints; ++i)
         {
-            indices.push_back(0); // Center point
-            indices.push_back(static_cast<unsigned int>(i));
-            indices.push_back(static_cast<unsigned int>(i+1));
+            indices.push_back(firstIndex); // Center point
+            indices.push_back(firstIndex + i);
+            indices.push_back(firstIndex + (i % nrPoints) + 1);
         }
-        indices.back() = 1; // Last index was one too far and should use the first point again, to close the circle
+    }
 
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::ShapeGeometryKey::operator<(const ShapeGeometryKey& other) const
+    {
+        const auto toTuple = [](const ShapeGeometryKey& key){
+            return std::make_tuple(key.circle, key.size.x, key.size.y, key.radius, key.borderThickness,
+                                   key.backgroundColor.getRed(), key.backgroundColor.getGreen(), key.backgroundColor.getBlue(), key.backgroundColor.getAlpha(),
+                                   key.borderColor.getRed(), key.borderColor.getGreen(), key.borderColor.getBlue(), key.borderColor.getAlpha());
+        };
+        return toTuple(*this) < toTuple(other);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -375,6 +355,72 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTarget::beginLayer(const RenderStates&, std::shared_ptr<BackendTexture>&, Vector2f)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::endLayer()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawLayer(const RenderStates& states, const std::shared_ptr<BackendTexture>& layerTexture, Vector2f size)
+    {
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 0}},
+            {{size.x, 0}, vertexColor, {1, 0}},
+            {{0, size.y}, vertexColor, {0, 1}},
+            {{size.x, size.y}, vertexColor, {1, 1}},
+        }};
+        const std::array<unsigned int, 6> indices = {{
+            0, 2, 1,
+            1, 2, 3
+        }};
+        drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), layerTexture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendRenderTarget::getLayerPixelSize(const RenderStates& states, Vector2f size) const
+    {
+        const Vector2f pixelsPerPoint = getLayerPixelsPerPoint(states);
+        return {static_cast<unsigned int>(std::ceil(size.x * pixelsPerPoint.x)),
+                static_cast<unsigned int>(std::ceil(size.y * pixelsPerPoint.y))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f BackendRenderTarget::getLayerPixelsPerPoint(const RenderStates& states) const
+    {
+        // The length of the transformed axes is the scaling of the transform, even when it also contains a rotation
+        const Vector2f origin = states.transform.transformPoint({0, 0});
+        const Vector2f axisX = states.transform.transformPoint({1, 0}) - origin;
+        const Vector2f axisY = states.transform.transformPoint({0, 1}) - origin;
+        return {m_pixelsPerPoint.x * std::sqrt((axisX.x * axisX.x) + (axisX.y * axisX.y)),
+                m_pixelsPerPoint.y * std::sqrt((axisY.x * axisY.x) + (axisY.y * axisY.y))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isLayerDrawnOneToOne(const RenderStates& states, const BackendTexture& layerTexture, Vector2f size) const
+    {
+        const Vector2f origin = states.transform.transformPoint({0, 0});
+        const Vector2f axisX = states.transform.transformPoint({1, 0}) - origin;
+        const Vector2f axisY = states.transform.transformPoint({0, 1}) - origin;
+        if ((axisX.y != 0) || (axisY.x != 0))
+            return false;
+
+        const Vector2f pixelsPerPoint = getLayerPixelsPerPoint(states);
+        return Vector2f{layerTexture.getSize()} == Vector2f{size.x * pixelsPerPoint.x, size.y * pixelsPerPoint.y};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTarget::drawTriangle(const RenderStates& states, const Vertex& point1, const Vertex& point2, const Vertex& point3)
     {
         const std::array<Vertex, 3> vertices = {{ point1, point2, point3 }};
@@ -385,29 +431,38 @@ namespace tgui
 
     void BackendRenderTarget::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness, const Color& borderColor)
     {
-        const float radius = size / 2.f;
-        const unsigned int nrPoints = static_cast<unsigned int>(std::ceil((radius + std::abs(borderThickness)) * 4));
-        if (borderThickness > 0)
+        const ShapeGeometryKey key{true, {size, size}, size / 2.f, borderThickness, backgroundColor, (borderThickness != 0) ? borderColor : Color{}};
+        const ShapeGeometry* cachedGeometry = findShapeGeometry(key);
+        if (!cachedGeometry)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            ShapeGeometry geometry;
+            const float radius = size / 2.f;
+            const unsigned int nrPoints = static_cast<unsigned int>(std::ceil((radius + std::abs(borderThickness)) * 4));
+            const std::vector<Vector2f> unitCirclePoints = getUnitCirclePoints(nrPoints);
+
+            std::vector<Vector2f> outerPoints;
+            std::vector<Vector2f> innerPoints;
+            if (borderThickness > 0)
+            {
+                getCirclePoints(outerPoints, unitCirclePoints, radius + borderThickness, -borderThickness);
+                getCirclePoints(innerPoints, unitCirclePoints, radius, 0);
+                addBordersAroundShape(geometry.vertices, geometry.indices, outerPoints, innerPoints, borderColor);
+            }
+            else if (borderThickness < 0)
+            {
+                getCirclePoints(outerPoints, unitCirclePoints, radius, 0);
+                getCirclePoints(innerPoints, unitCirclePoints, radius + borderThickness, -borderThickness);
+                addBordersAroundShape(geometry.vertices, geometry.indices, outerPoints, innerPoints, borderColor);
+            }
+            else // No outline
+                getCirclePoints(innerPoints, unitCirclePoints, radius, 0);
+
+            addInnerShape(geometry.vertices, geometry.indices, innerPoints, {radius, radius}, backgroundColor);
+            cachedGeometry = &addShapeGeometry(key, std::move(geometry));
         }
-        else if (borderThickness < 0)
-        {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
-        }
-        else // No outline
-        {
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
-        }
+        drawVertexArray(states, cachedGeometry->vertices.data(), cachedGeometry->vertices.size(),
+                        cachedGeometry->indices.data(), cachedGeometry->indices.size(), nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,26 +476,87 @@ namespace tgui
         if (radius > size.y / 2)
             radius = size.y / 2;
 
-        const unsigned int nrCornerPoints = std::max(1u, static_cast<unsigned int>(std::ceil(radius * 2)));
-        const std::vector<Vector2f>& outerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, size, radius, 0);
-
         const float borderWidth = borders.getLeft();
-        if (borderWidth > 0)
+        const ShapeGeometryKey key{false, size, radius, borderWidth, backgroundColor, (borderWidth > 0) ? borderColor : Color{}};
+        const ShapeGeometry* cachedGeometry = findShapeGeometry(key);
+        if (!cachedGeometry)
         {
-            radius = std::max(0.f, radius - borderWidth);
-            const Vector2f innerSize = {std::max(0.f, size.x - 2*borderWidth), std::max(0.f, size.y - 2*borderWidth)};
-            if (radius > innerSize.x / 2)
-                radius = innerSize.x / 2;
-            if (radius > innerSize.y / 2)
-                radius = innerSize.y / 2;
+            ShapeGeometry geometry;
+            const unsigned int nrCornerPoints = std::max(1u, static_cast<unsigned int>(std::ceil(radius * 2)));
+            const std::vector<Vector2f> unitCirclePoints = getUnitCirclePoints(std::max(1u, 4 * (nrCornerPoints - 1)));
+
+            std::vector<Vector2f> outerPoints;
+            getRoundedRectPoints(outerPoints, unitCirclePoints, nrCornerPoints, size, radius, 0);
+
+            if (borderWidth > 0)
+            {
+                float innerRadius = std::max(0.f, radius - borderWidth);
+                const Vector2f innerSize = {std::max(0.f, size.x - 2*borderWidth), std::max(0.f, size.y - 2*borderWidth)};
+                if (innerRadius > innerSize.x / 2)
+                    innerRadius = innerSize.x / 2;
+                if (innerRadius > innerSize.y / 2)
+                    innerRadius = innerSize.y / 2;
+
+                std::vector<Vector2f> innerPoints;
+                getRoundedRectPoints(innerPoints, unitCirclePoints, nrCornerPoints, innerSize, innerRadius, borderWidth);
+
+                addBordersAroundShape(geometry.vertices, geometry.indices, outerPoints, innerPoints, borderColor);
+                addInnerShape(geometry.vertices, geometry.indices, innerPoints, size/2.f, backgroundColor);
+            }
+            else // There are no borders
+                addInnerShape(geometry.vertices, geometry.indices, outerPoints, size/2.f, backgroundColor);
+
+            cachedGeometry = &addShapeGeometry(key, std::move(geometry));
+        }
+
+        drawVertexArray(states, cachedGeometry->vertices.data(), cachedGeometry->vertices.size(),
+                        cachedGeometry->indices.data(), cachedGeometry->indices.size(), nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Vector2f> BackendRenderTarget::getUnitCirclePoints(unsigned int nrPoints)
+    {
+#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
+        const float twoPi = 2.f * std::numbers::pi_v<float>;
+#else
+        const float twoPi = 2.f * 3.14159265359f;
+#endif
+        std::vector<Vector2f> points;
+        points.reserve(nrPoints);
+        for (unsigned int i = 0; i < nrPoints; ++i)
+            points.emplace_back(std::cos(twoPi * i / nrPoints), std::sin(twoPi * i / nrPoints));
 
-            const std::vector<Vector2f>& innerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, innerSize, radius, borderWidth);
+        return points;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, size/2.f, backgroundColor);
+    const BackendRenderTarget::ShapeGeometry* BackendRenderTarget::findShapeGeometry(const ShapeGeometryKey& key)
+    {
+        const auto it = m_shapeGeometryCache.find(key);
+        if (it == m_shapeGeometryCache.end())
+            return nullptr;
+
+        m_shapeGeometries.splice(m_shapeGeometries.begin(), m_shapeGeometries, it->second);
+        return &it->second->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendRenderTarget::ShapeGeometry& BackendRenderTarget::addShapeGeometry(const ShapeGeometryKey& key, ShapeGeometry&& geometry)
+    {
+        // Animations can keep changing the size or color of shapes, so the shape that wasn't drawn for the longest time
+        // is removed once the cache becomes too large. Shapes that are drawn every frame thus remain cached.
+        if (m_shapeGeometryCache.size() >= MaxCachedShapeGeometries)
+        {
+            m_shapeGeometryCache.erase(m_shapeGeometries.back().first);
+            m_shapeGeometries.pop_back();
         }
-        else // There are no borders
-            drawInnerShape(this, states, outerPoints, size/2.f, backgroundColor);
+
+        m_shapeGeometries.emplace_front(key, std::move(geometry));
+        m_shapeGeometryCache.emplace(key, m_shapeGeometries.begin());
+        return m_shapeGeometries.front().second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,6 +300,19 @@ namespace tgui
         const float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
         const float fontScale          = m_font->getFontScale();
 
+        // Glyphs in a distance field texture are surrounded by distance values, which have to be included in the quads
+        float texturePadding = 1;
+        float positionPadding = 1 / fontScale;
+        float distanceFieldOutline = 0;
+        if (m_font->isDistanceFieldEnabled())
+        {
+            texturePadding = static_cast<float>(BackendFont::DistanceFieldSpread);
+            positionPadding = BackendFont::getDistanceFieldMaxOutlineThickness(m_characterSize);
+
+            // The outline glyph is the fill glyph, the shader moves its edge outwards by the (limited) outline thickness
+            distanceFieldOutline = std::min(std::max(0.f, m_outlineThickness), positionPadding);
+        }
+
         // Compute the location of the strike through dynamically
         // We use the center point of the lowercase 'x' glyph as the reference
         // We reuse the underline thickness as the thickness of the strike through as well
@@ -370,11 +383,11 @@ namespace tgui
             {
                 const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
-                float top    = glyph.bounds.top;
-                float right  = glyph.bounds.left + glyph.bounds.width;
+                float top    = glyph.bounds.top - distanceFieldOutline;
+                float right  = glyph.bounds.left + glyph.bounds.width + distanceFieldOutline;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, texturePadding, positionPadding, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -382,7 +395,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, texturePadding, positionPadding, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -444,19 +457,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float fontScale, float italicShear)
+    void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph,
+                                   float texturePadding, float positionPadding, float italicShear)
     {
-        const float padding = 1;
-
-        const float left   = glyph.bounds.left - padding / fontScale;
-        const float top    = glyph.bounds.top - padding / fontScale;
-        const float right  = glyph.bounds.left + glyph.bounds.width + padding / fontScale;
-        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding / fontScale;
-
-        const float u1 = glyph.textureRect.left - padding;
-        const float v1 = glyph.textureRect.top - padding;
-        const float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
-        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + padding;
+        const float left   = glyph.bounds.left - positionPadding;
+        const float top    = glyph.bounds.top - positionPadding;
+        const float right  = glyph.bounds.left + glyph.bounds.width + positionPadding;
+        const float bottom = glyph.bounds.top  + glyph.bounds.height + positionPadding;
+
+        const float u1 = glyph.textureRect.left - texturePadding;
+        const float v1 = glyph.textureRect.top - texturePadding;
+        const float u2 = glyph.textureRect.left + glyph.textureRect.width + texturePadding;
+        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + texturePadding;
 
         vertices.emplace_back(Vector2f{position.x + left  - italicShear * top   , position.y + top   }, color, Vector2f{u1, v1});
         vertices.emplace_back(Vector2f{position.x + right - italicShear * top   , position.y + top   }, color, Vector2f{u2, v1});
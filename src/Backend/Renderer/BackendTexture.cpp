@@ -25,10 +25,30 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    BackendTexture::PixelStorage BackendTexture::m_defaultPixelStorage = BackendTexture::PixelStorage::Full;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setPixelStorage(PixelStorage storage)
+    {
+        m_pixelStorage = storage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getPixelStorage() const
+    {
+        return m_pixelStorage;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth)
@@ -38,7 +58,21 @@ namespace tgui
         if (!loadTextureOnly(size, pixels.get(), smooth))
             return false;
 
-        m_pixels = std::move(pixels);
+        if (m_pixelStorage == PixelStorage::Full)
+        {
+            m_pixels = std::move(pixels);
+            return true;
+        }
+
+        // Only remember which pixels are transparent, the pixels themselves are no longer needed once they are uploaded
+        const std::size_t pixelCount = static_cast<std::size_t>(size.x) * size.y;
+        m_transparencyMask = std::make_unique<std::uint8_t[]>((pixelCount + 7) / 8); // Zero-initialized
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            if (pixels[i * 4 + 3] <= m_alphaMaskThreshold)
+                m_transparencyMask[i / 8] |= static_cast<std::uint8_t>(1 << (i % 8));
+        }
+
         return true;
     }
 
@@ -49,6 +83,7 @@ namespace tgui
         TGUI_ASSERT((size.x > 0) && (size.y > 0), "load and loadTextureOnly functions in BackendTexture needs a valid size");
 
         m_pixels = nullptr;
+        m_transparencyMask = nullptr;
         m_imageSize = size;
         m_isSmooth = smooth;
         return true;
@@ -56,6 +91,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::updatePixels(const UIntRect& rect, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT(pixels, "updatePixels in BackendTexture doesn't accept a nullptr for pixels");
+
+        if ((rect.width == 0) || (rect.height == 0) || (rect.left + rect.width > m_imageSize.x) || (rect.top + rect.height > m_imageSize.y))
+            return false;
+
+        // If the texture was created without pixels then start keeping track of them now
+        if (!m_pixels && !m_transparencyMask)
+        {
+            const std::size_t pixelCount = static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y;
+            if (m_pixelStorage == PixelStorage::Full)
+                m_pixels = std::make_unique<std::uint8_t[]>(pixelCount * 4); // Zero-initialized
+            else
+                m_transparencyMask = std::make_unique<std::uint8_t[]>((pixelCount + 7) / 8); // Zero-initialized
+        }
+
+        for (unsigned int y = 0; y < rect.height; ++y)
+        {
+            const std::size_t rowStart = static_cast<std::size_t>(rect.top + y) * m_imageSize.x + rect.left;
+            const std::uint8_t* rowPixels = &pixels[static_cast<std::size_t>(y) * rect.width * 4];
+            if (m_pixels)
+            {
+                std::memcpy(&m_pixels[rowStart * 4], rowPixels, static_cast<std::size_t>(rect.width) * 4);
+                continue;
+            }
+
+            for (unsigned int x = 0; x < rect.width; ++x)
+            {
+                const std::size_t pixelIndex = rowStart + x;
+                if (rowPixels[x * 4 + 3] <= m_alphaMaskThreshold)
+                    m_transparencyMask[pixelIndex / 8] |= static_cast<std::uint8_t>(1 << (pixelIndex % 8));
+                else
+                    m_transparencyMask[pixelIndex / 8] &= static_cast<std::uint8_t>(~(1 << (pixelIndex % 8)));
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -79,13 +156,16 @@ namespace tgui
 
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_pixels)
+        if (!m_pixels && !m_transparencyMask)
             return false;
 
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTexture::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        const std::size_t pixelIndex = static_cast<std::size_t>(pixel.y) * m_imageSize.x + pixel.x;
+        if (m_transparencyMask)
+            return (m_transparencyMask[pixelIndex / 8] & (1 << (pixelIndex % 8))) != 0;
+        else
+            return (m_pixels[pixelIndex * 4 + 3] <= m_alphaMaskThreshold);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +176,34 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setDefaultPixelStorage(PixelStorage storage)
+    {
+        m_defaultPixelStorage = storage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getDefaultPixelStorage()
+    {
+        return m_defaultPixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setAlphaMaskThreshold(std::uint8_t threshold)
+    {
+        m_alphaMaskThreshold = threshold;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint8_t BackendTexture::getAlphaMaskThreshold() const
+    {
+        return m_alphaMaskThreshold;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
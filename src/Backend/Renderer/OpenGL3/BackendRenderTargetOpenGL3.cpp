@@ -33,12 +33,24 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <numeric>
+    #include <algorithm>
+    #include <array>
+    #include <cmath>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    // Returns how much the transform scales distances (when it scales differently in both directions, the horizontal scale is used)
+    TGUI_NODISCARD static float getTransformScale(const Transform& transform)
+    {
+        const Vector2f transformedUnit = transform.transformPoint({1, 0}) - transform.transformPoint({0, 0});
+        return std::sqrt(transformedUnit.x * transformedUnit.x + transformedUnit.y * transformedUnit.y);
+    }
+
+    TGUI_NODISCARD static GLuint linkShaderProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource);
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TGUI_NODISCARD static GLuint createShaderProgram()
@@ -89,6 +101,100 @@ namespace tgui
             "}"
         };
 
+        return linkShaderProgram(vertexShaderSource, fragmentShaderSource);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint createSdfShaderProgram()
+    {
+        // The vertex shader passes the position relative to the center of the shape to the fragment shader
+        const GLchar* vertexShaderSource =
+        {
+            "#version 330 core\n"
+            "uniform mat4 projectionMatrix;\n"
+            "uniform vec2 uShapeCenter;\n"
+            "layout(location=0) in vec2 inPosition;\n"
+            "layout(location=1) in vec4 inColor;\n"
+            "out vec4 color;\n"
+            "out vec2 localPos;\n"
+            "void main() {\n"
+            "    gl_Position = projectionMatrix * vec4(inPosition.x, inPosition.y, 0, 1);\n"
+            "    color = inColor;\n"
+            "    localPos = inPosition - uShapeCenter;\n"
+            "}"
+        };
+
+        // The fragment shader calculates the distance to the edge of a rounded rectangle (a circle is a rounded rectangle
+        // with a radius equal to half its size) and uses it to blend between the background, border and transparent pixels.
+        const GLchar* fragmentShaderSource =
+        {
+            "#version 330 core\n"
+            "uniform vec2 uHalfSize;\n"
+            "uniform float uRadius;\n"
+            "uniform float uBorderThickness;\n"
+            "uniform vec4 uBorderColor;\n"
+            "uniform float uPixelSize;\n"
+            "in vec4 color;\n"
+            "in vec2 localPos;\n"
+            "out vec4 outColor;\n"
+            "void main() {\n"
+            "    vec2 q = abs(localPos) - uHalfSize + vec2(uRadius);\n"
+            "    float dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - uRadius;\n"
+            "    float outerCoverage = clamp(0.5 - dist / uPixelSize, 0.0, 1.0);\n"
+            "    float innerCoverage = clamp(0.5 - (dist + uBorderThickness) / uPixelSize, 0.0, 1.0);\n"
+            "    vec4 fillColor = mix(uBorderColor, color, innerCoverage);\n"
+            "    outColor = vec4(fillColor.rgb, fillColor.a * outerCoverage);\n"
+            "}"
+        };
+
+        return linkShaderProgram(vertexShaderSource, fragmentShaderSource);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint createDistanceFieldTextShaderProgram()
+    {
+        const GLchar* vertexShaderSource =
+        {
+            "#version 330 core\n"
+            "uniform mat4 projectionMatrix;\n"
+            "layout(location=0) in vec2 inPosition;\n"
+            "layout(location=1) in vec4 inColor;\n"
+            "layout(location=2) in vec2 inTexCoord;\n"
+            "out vec4 color;\n"
+            "out vec2 texCoord;\n"
+            "void main() {\n"
+            "    gl_Position = projectionMatrix * vec4(inPosition.x, inPosition.y, 0, 1);\n"
+            "    color = inColor;\n"
+            "    texCoord = inTexCoord;\n"
+            "}"
+        };
+
+        // The alpha channel of the font texture contains the distance to the edge of the glyph, where 0.5 lies on the edge
+        const GLchar* fragmentShaderSource =
+        {
+            "#version 330 core\n"
+            "uniform sampler2D uTexture;\n"
+            "uniform float uThreshold;\n"
+            "uniform float uSmoothing;\n"
+            "in vec4 color;\n"
+            "in vec2 texCoord;\n"
+            "out vec4 outColor;\n"
+            "void main() {\n"
+            "    float dist = texture(uTexture, texCoord).a;\n"
+            "    float coverage = smoothstep(uThreshold - uSmoothing, uThreshold + uSmoothing, dist);\n"
+            "    outColor = vec4(color.rgb, color.a * coverage);\n"
+            "}"
+        };
+
+        return linkShaderProgram(vertexShaderSource, fragmentShaderSource);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint linkShaderProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource)
+    {
         // Create the vertex shader
         GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
         if (vertexShader == 0)
@@ -158,6 +264,11 @@ namespace tgui
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
+
+        if (m_sdfShaderProgram)
+            TGUI_GL_CHECK(glDeleteProgram(m_sdfShaderProgram));
+        if (m_textShaderProgram)
+            TGUI_GL_CHECK(glDeleteProgram(m_textShaderProgram));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,6 +350,22 @@ namespace tgui
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
+        if (m_packedVertexAttribsSet != m_packedVerticesEnabled)
+            setVertexAttribs();
+
+        // The shader for rounded shapes is only created once it is needed, as we need the OpenGL context to be active
+        if (m_sdfShapesEnabled && !m_sdfShaderProgram)
+        {
+            m_sdfShaderProgram = createSdfShaderProgram();
+            m_sdfProjectionMatrixLocation = glGetUniformLocation(m_sdfShaderProgram, "projectionMatrix");
+            m_sdfShapeCenterLocation = glGetUniformLocation(m_sdfShaderProgram, "uShapeCenter");
+            m_sdfHalfSizeLocation = glGetUniformLocation(m_sdfShaderProgram, "uHalfSize");
+            m_sdfRadiusLocation = glGetUniformLocation(m_sdfShaderProgram, "uRadius");
+            m_sdfBorderThicknessLocation = glGetUniformLocation(m_sdfShaderProgram, "uBorderThickness");
+            m_sdfBorderColorLocation = glGetUniformLocation(m_sdfShaderProgram, "uBorderColor");
+            m_sdfPixelSizeLocation = glGetUniformLocation(m_sdfShaderProgram, "uPixelSize");
+        }
+
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
@@ -279,27 +406,8 @@ namespace tgui
     void BackendRenderTargetOpenGL3::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
-        {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
-                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
-
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
-            }
-            else
-            {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
-            }
-        }
-
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+        bindTexture(texture);
+        uploadVertices(vertices, vertexCount);
 
         const Transform finalTransform = m_projectionTransform * states.transform;
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
@@ -317,6 +425,278 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetOpenGL3::drawText(const RenderStates& states, const Text& text)
+    {
+        const auto& backendText = text.getBackendText();
+        const auto& font = backendText->getFont();
+        if (!font || !font->isDistanceFieldEnabled() || (backendText->getCharacterSize() == 0))
+        {
+            BackendRenderTarget::drawText(states, text);
+            return;
+        }
+
+        // The shader is only created once it is needed, as most fonts don't use distance fields
+        if (!m_textShaderProgram)
+        {
+            m_textShaderProgram = createDistanceFieldTextShaderProgram();
+            m_textProjectionMatrixLocation = glGetUniformLocation(m_textShaderProgram, "projectionMatrix");
+            m_textThresholdLocation = glGetUniformLocation(m_textShaderProgram, "uThreshold");
+            m_textSmoothingLocation = glGetUniformLocation(m_textShaderProgram, "uSmoothing");
+        }
+
+        RenderStates transformedStates = states;
+        transformedStates.transform.translate(text.getPosition());
+
+        // Round the text to the nearest pixel to try to avoid blurry text
+        transformedStates.transform.roundPosition(m_pixelsPerPoint.x, m_pixelsPerPoint.y);
+
+        const float pixelsPerUnit = getTransformScale(transformedStates.transform) * m_pixelsPerPoint.x;
+        if (pixelsPerUnit <= 0)
+            return;
+
+        // Distances in the texture are measured in pixels at the reference size, while the text has its own character size.
+        // The anti-aliased edge is made one screen pixel wide.
+        const float distancePerUnit = (static_cast<float>(BackendFont::DistanceFieldReferenceSize) / backendText->getCharacterSize())
+                                    / (2.f * BackendFont::DistanceFieldSpread);
+        const float smoothing = 0.5f * distancePerUnit / pixelsPerUnit;
+
+        // The distance field only reaches a limited distance outside the glyph, so thicker outlines are drawn thinner
+        const float outlineThickness = std::min(backendText->getOutlineThickness(),
+                                                BackendFont::getDistanceFieldMaxOutlineThickness(backendText->getCharacterSize()));
+
+        auto vertexData = backendText->getVertexData();
+
+        TGUI_GL_CHECK(glUseProgram(m_textShaderProgram));
+
+        const Transform finalTransform = m_projectionTransform * transformedStates.transform;
+        TGUI_GL_CHECK(glUniformMatrix4fv(m_textProjectionMatrixLocation, 1, GL_FALSE, finalTransform.getMatrix().data()));
+        TGUI_GL_CHECK(glUniform1f(m_textSmoothingLocation, smoothing));
+
+        for (std::size_t i = 0; i < vertexData.size(); ++i)
+        {
+            // The outline vertices are returned before the fill vertices. They use the same glyphs, but the edge is moved outwards.
+            const bool isOutline = (backendText->getOutlineThickness() != 0) && (vertexData.size() > 1) && (i == 0);
+            const float threshold = isOutline ? (0.5f - (outlineThickness * distancePerUnit)) : 0.5f;
+            TGUI_GL_CHECK(glUniform1f(m_textThresholdLocation, threshold));
+
+            const std::shared_ptr<std::vector<Vertex>>& vertices = vertexData[i].second;
+            bindTexture(vertexData[i].first);
+            uploadVertices(vertices->data(), vertices->size());
+            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices->size())));
+        }
+
+        TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness, const Color& borderColor)
+    {
+        if (!m_sdfShaderProgram || !m_sdfShapesEnabled)
+        {
+            BackendRenderTarget::drawCircle(states, size, backgroundColor, borderThickness, borderColor);
+            return;
+        }
+
+        // A positive border thickness places the borders outside the circle, a negative one places them inside
+        const float radius = size / 2.f;
+        if (borderThickness > 0)
+        {
+            drawSdfShape(states, {-borderThickness, -borderThickness}, {size + 2*borderThickness, size + 2*borderThickness},
+                         radius + borderThickness, borderThickness, backgroundColor, borderColor);
+        }
+        else
+            drawSdfShape(states, {0, 0}, {size, size}, radius, -borderThickness, backgroundColor, borderColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor,
+                                                          float radius, const Borders& borders, const Color& borderColor)
+    {
+        if (!m_sdfShaderProgram || !m_sdfShapesEnabled)
+        {
+            BackendRenderTarget::drawRoundedRectangle(states, size, backgroundColor, radius, borders, borderColor);
+            return;
+        }
+
+        // Radius can never be larger than half the width or height
+        radius = std::min({radius, size.x / 2, size.y / 2});
+
+        // Just like in the tessellated version, only the left border is used as width for all borders
+        drawSdfShape(states, {0, 0}, size, radius, std::max(0.f, borders.getLeft()), backgroundColor, borderColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setSdfShapesEnabled(bool enabled)
+    {
+        // The shader will be created when the gui is drawn, as the OpenGL context might not be active here
+        m_sdfShapesEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isSdfShapesEnabled() const
+    {
+        return m_sdfShapesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setPackedVerticesEnabled(bool packed)
+    {
+        // The vertex attributes will be changed when the gui is drawn, as the OpenGL context might not be active here
+        m_packedVerticesEnabled = packed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isPackedVerticesEnabled() const
+    {
+        return m_packedVerticesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::beginLayer(const RenderStates& states, std::shared_ptr<BackendTexture>& layerTexture, Vector2f size)
+    {
+        // When the layer is drawn scaled, it gets as many pixels as it will cover, so that it is as sharp as the widgets would be
+        const Vector2f pixelsPerPoint = getLayerPixelsPerPoint(states);
+        const Vector2u pixelSize = getLayerPixelSize(states, size);
+        if ((pixelSize.x == 0) || (pixelSize.y == 0))
+            return false;
+
+        if (!layerTexture || (layerTexture->getSize() != pixelSize))
+        {
+            auto texture = std::make_shared<BackendTextureOpenGL3>();
+            if (!texture->loadTextureOnly(pixelSize, nullptr, false))
+                return false;
+
+            layerTexture = std::move(texture);
+        }
+
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(layerTexture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+        const auto& textureOpenGL3 = std::static_pointer_cast<BackendTextureOpenGL3>(layerTexture);
+
+        LayerState state;
+        TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &state.oldFramebuffer));
+        TGUI_GL_CHECK(glGenFramebuffers(1, &state.framebuffer));
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, state.framebuffer));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureOpenGL3->getInternalTexture(), 0));
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(state.oldFramebuffer)));
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &state.framebuffer));
+            return false;
+        }
+
+        state.viewRect = m_viewRect;
+        state.viewport = m_viewport;
+        state.targetSize = m_targetSize;
+        state.clipLayers = std::move(m_clipLayers);
+        state.pixelsPerPoint = m_pixelsPerPoint;
+        state.projectionTransform = m_projectionTransform;
+        m_layers.push_back(std::move(state));
+
+        // The layer is rendered as if it were a window with the same size as the layer
+        m_viewRect = {0, 0, size.x, size.y};
+        m_viewport = {0, 0, size.x * pixelsPerPoint.x, size.y * pixelsPerPoint.y};
+        m_targetSize = Vector2f{pixelSize};
+        m_clipLayers.clear();
+        m_pixelsPerPoint = pixelsPerPoint;
+
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({-1, 1});
+        m_projectionTransform.scale({2.f / size.x, -2.f / size.y});
+
+        const std::array<int, 4> viewportGL = {0, static_cast<int>(m_targetSize.y - m_viewport.height),
+                                               static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)};
+        TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+        TGUI_GL_CHECK(glScissor(0, 0, static_cast<GLsizei>(pixelSize.x), static_cast<GLsizei>(pixelSize.y)));
+
+        GLfloat oldClearColor[4];
+        TGUI_GL_CHECK(glGetFloatv(GL_COLOR_CLEAR_VALUE, static_cast<GLfloat*>(oldClearColor)));
+        TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        TGUI_GL_CHECK(glClearColor(oldClearColor[0], oldClearColor[1], oldClearColor[2], oldClearColor[3]));
+
+        resetBlendFunc();
+
+        // The layer texture may still be bound from when it was last drawn, it can't be sampled while rendering to it
+        m_currentTexture = nullptr;
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::endLayer()
+    {
+        TGUI_ASSERT(!m_layers.empty(), "BackendRenderTargetOpenGL3::endLayer can only be called after beginLayer returned true");
+
+        LayerState& state = m_layers.back();
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(state.oldFramebuffer)));
+        TGUI_GL_CHECK(glDeleteFramebuffers(1, &state.framebuffer));
+
+        m_viewRect = state.viewRect;
+        m_viewport = state.viewport;
+        m_targetSize = state.targetSize;
+        m_clipLayers = std::move(state.clipLayers);
+        m_pixelsPerPoint = state.pixelsPerPoint;
+        m_projectionTransform = state.projectionTransform;
+        m_layers.pop_back();
+
+        const std::array<int, 4> viewportGL = {static_cast<int>(m_viewport.left), static_cast<int>(m_targetSize.y - m_viewport.top - m_viewport.height),
+                                               static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)};
+        TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+
+        if (m_clipLayers.empty())
+            updateClipping(m_viewRect, m_viewport);
+        else
+            updateClipping(m_clipLayers.back().first, m_clipLayers.back().second);
+
+        resetBlendFunc();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawLayer(const RenderStates& states, const std::shared_ptr<BackendTexture>& layerTexture, Vector2f size)
+    {
+        // The framebuffer is stored upside down in the texture
+        const Vertex::Color vertexColor(Color::White);
+        const std::array<Vertex, 4> vertices = {{
+            {{0, 0}, vertexColor, {0, 1}},
+            {{size.x, 0}, vertexColor, {1, 1}},
+            {{0, size.y}, vertexColor, {0, 0}},
+            {{size.x, size.y}, vertexColor, {1, 0}},
+        }};
+        const std::array<unsigned int, 6> indices = {{
+            0, 2, 1,
+            1, 2, 3
+        }};
+
+        // Pixels only map one-to-one on the screen when the layer isn't scaled or rotated, otherwise it has to be interpolated
+        layerTexture->setSmooth(!isLayerDrawnOneToOne(states, *layerTexture, size));
+
+        // The colors in the layer texture are already multiplied with their alpha value
+        TGUI_GL_CHECK(glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), layerTexture);
+        resetBlendFunc();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::resetBlendFunc()
+    {
+        if (m_layers.empty())
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+        else
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
@@ -336,6 +716,123 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetOpenGL3::bindTexture(const std::shared_ptr<BackendTexture>& texture)
+    {
+        // Change the bound texture if it changed
+        if (m_currentTexture != texture)
+        {
+            if (texture)
+            {
+                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+
+                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+            }
+            else
+            {
+                m_currentTexture = nullptr;
+                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::uploadVertices(const Vertex* vertices, std::size_t vertexCount)
+    {
+        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
+        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
+        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        if (m_packedVerticesEnabled)
+        {
+            if (m_packedVertices.size() < vertexCount)
+                m_packedVertices.resize(vertexCount);
+
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_packedVertices[i] = PackedVertex{vertices[i]};
+
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(PackedVertex)), m_packedVertices.data(), GL_DYNAMIC_DRAW));
+        }
+        else
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawSdfShape(const RenderStates& states, Vector2f position, Vector2f size, float radius,
+                                                  float borderThickness, const Color& backgroundColor, const Color& borderColor)
+    {
+        // Find out how large a pixel is in the coordinate system of the shape, which determines the width of the anti-aliased edge
+        const float pixelsPerUnit = getTransformScale(states.transform) * m_pixelsPerPoint.x;
+        if (pixelsPerUnit <= 0)
+            return;
+
+        const float pixelSize = 1 / pixelsPerUnit;
+
+        // The quad is made one pixel larger than the shape to make room for the anti-aliased edge
+        const Vertex::Color vertexColor(backgroundColor);
+        const std::array<Vertex, 4> vertices = {{
+            {{position.x - pixelSize, position.y - pixelSize}, vertexColor},
+            {{position.x + size.x + pixelSize, position.y - pixelSize}, vertexColor},
+            {{position.x - pixelSize, position.y + size.y + pixelSize}, vertexColor},
+            {{position.x + size.x + pixelSize, position.y + size.y + pixelSize}, vertexColor},
+        }};
+
+        // Without borders, the border color is set to the background color so that the edge doesn't get a different color
+        const Color& edgeColor = (borderThickness > 0) ? borderColor : backgroundColor;
+
+        TGUI_GL_CHECK(glUseProgram(m_sdfShaderProgram));
+
+        const Transform finalTransform = m_projectionTransform * states.transform;
+        TGUI_GL_CHECK(glUniformMatrix4fv(m_sdfProjectionMatrixLocation, 1, GL_FALSE, finalTransform.getMatrix().data()));
+        TGUI_GL_CHECK(glUniform2f(m_sdfShapeCenterLocation, position.x + size.x / 2.f, position.y + size.y / 2.f));
+        TGUI_GL_CHECK(glUniform2f(m_sdfHalfSizeLocation, size.x / 2.f, size.y / 2.f));
+        TGUI_GL_CHECK(glUniform1f(m_sdfRadiusLocation, radius));
+        TGUI_GL_CHECK(glUniform1f(m_sdfBorderThicknessLocation, borderThickness));
+        TGUI_GL_CHECK(glUniform4f(m_sdfBorderColorLocation, edgeColor.getRed() / 255.f, edgeColor.getGreen() / 255.f,
+                                  edgeColor.getBlue() / 255.f, edgeColor.getAlpha() / 255.f));
+        TGUI_GL_CHECK(glUniform1f(m_sdfPixelSizeLocation, pixelSize));
+
+        uploadVertices(vertices.data(), vertices.size());
+        TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLE_STRIP, 0, static_cast<GLsizei>(vertices.size())));
+
+        TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setVertexAttribs()
+    {
+        TGUI_GL_CHECK(glEnableVertexAttribArray(0)); // Position
+        TGUI_GL_CHECK(glEnableVertexAttribArray(1)); // Color
+        TGUI_GL_CHECK(glEnableVertexAttribArray(2)); // TexCoord
+
+        if (m_packedVerticesEnabled)
+        {
+            // Position is stored as x,y in the first 2 floats
+            // Color is stored as r,g,b,a in the next 4 bytes
+            // Texture coordinate is stored as u,v in the last 2 unsigned shorts, which are normalized to the [0,1] range
+            static_assert(sizeof(PackedVertex) == 8 + 4 + 4, "Size of tgui::PackedVertex has to match the data");
+            TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(PackedVertex), reinterpret_cast<GLvoid*>(0)));
+            TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PackedVertex), reinterpret_cast<GLvoid*>(8)));
+            TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        }
+        else
+        {
+            // Position is stored as x,y in the first 2 floats
+            // Color is stored as r,g,b,a in the next 4 bytes
+            // Texture coordinate is stored as u,v in the last 2 floats
+            static_assert(sizeof(Vertex) == 8 + 4 + 8, "Size of tgui::Vertex has to match the data");
+            TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
+            TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
+            TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        }
+
+        m_packedVertexAttribsSet = m_packedVerticesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::createBuffers()
     {
         TGUI_GL_CHECK(glGenVertexArrays(1, &m_vertexArray));
@@ -349,17 +846,7 @@ namespace tgui
         TGUI_GL_CHECK(glGenBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
-        TGUI_GL_CHECK(glEnableVertexAttribArray(0)); // Position
-        TGUI_GL_CHECK(glEnableVertexAttribArray(1)); // Color
-        TGUI_GL_CHECK(glEnableVertexAttribArray(2)); // TexCoord
-
-        // Position is stored as x,y in the first 2 floats
-        // Color is stored as r,g,b,a in the next 4 bytes
-        // Texture coordinate is stored as u,v in the last 2 floats
-        static_assert(sizeof(Vertex) == 8 + 4 + 8, "Size of tgui::Vertex has to match the data");
-        TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
-        TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
-        TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        setVertexAttribs();
 
         TGUI_GL_CHECK(glBindVertexArray(0));
 
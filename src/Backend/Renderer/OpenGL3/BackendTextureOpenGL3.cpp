@@ -99,6 +99,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureOpenGL3::updatePixels(const UIntRect& rect, const std::uint8_t* pixels)
+    {
+        if (!BackendTexture::updatePixels(rect, pixels))
+            return false;
+
+        if (!m_textureId)
+            return false;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(rect.left), static_cast<GLint>(rect.top),
+            static_cast<GLsizei>(rect.width), static_cast<GLsizei>(rect.height), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureOpenGL3::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -108,8 +108,11 @@ namespace tgui
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
             SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
 
-        // Draw the widgets
+        // Draw the widgets. Draw calls with the same texture are merged until the state of the renderer has to change.
+        m_batchingEnabled = true;
         root->draw(*this, {});
+        flushBatch();
+        m_batchingEnabled = false;
 
         // Restore the old blend mode
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
@@ -131,35 +134,69 @@ namespace tgui
     void BackendRenderTargetSDL::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        SDL_Texture* textureSDL = nullptr;
-        if (texture)
+        TGUI_ASSERT(!texture || std::dynamic_pointer_cast<BackendTextureSDL>(texture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
+
+        // Draw calls can only be merged when they use the same texture
+        if (texture != m_batchTexture)
+            flushBatch();
+
+        m_batchTexture = texture;
+
+        const std::size_t firstVertex = m_batchVertices.size();
+        m_batchVertices.insert(m_batchVertices.end(), vertices, vertices + vertexCount);
+        (m_projectionTransform * states.transform).transformVertexPositions(m_batchVertices.data() + firstVertex, vertexCount);
+
+        // The indices refer to the vertices that were passed to this function, so they need to be offset in the merged batch
+        if (indices)
+        {
+            m_batchIndices.reserve(m_batchIndices.size() + indexCount);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices.push_back(static_cast<int>(firstVertex + indices[i]));
+        }
+        else
         {
-            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(texture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
-            textureSDL = std::static_pointer_cast<BackendTextureSDL>(texture)->getInternalTexture();
+            m_batchIndices.reserve(m_batchIndices.size() + vertexCount);
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchIndices.push_back(static_cast<int>(firstVertex + i));
         }
 
-        const Transform finalTransform = m_projectionTransform * states.transform;
-        std::vector<Vertex> verticesSDL(vertices, vertices + vertexCount);
-        for (std::size_t i = 0; i < vertexCount; ++i)
+        // When not drawing the gui, there is no guarantee that flushBatch will be called later
+        if (!m_batchingEnabled)
+            flushBatch();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::flushBatch()
+    {
+        if (!m_batchIndices.empty())
         {
-            const Vector2f transformedPosition = finalTransform.transformPoint(vertices[i].position);
-            verticesSDL[i].position.x = transformedPosition.x;
-            verticesSDL[i].position.y = transformedPosition.y;
+            // The internal texture is only retrieved now, because a canvas could have replaced it since the vertices were added
+            SDL_Texture* textureSDL = nullptr;
+            if (m_batchTexture)
+                textureSDL = std::static_pointer_cast<BackendTextureSDL>(m_batchTexture)->getInternalTexture();
+
+            // We use SDL_RenderGeometry instead of SDL_RenderGeometryRaw because it's easier and because the signature of
+            // the SDL_RenderGeometryRaw function is different in SDL 2.0.18 and SDL >= 2.0.20
+            static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
+            SDL_RenderGeometry(m_renderer, textureSDL,
+                               reinterpret_cast<const SDL_Vertex*>(m_batchVertices.data()), static_cast<int>(m_batchVertices.size()),
+                               m_batchIndices.data(), static_cast<int>(m_batchIndices.size()));
         }
 
-        // We use SDL_RenderGeometry instead of SDL_RenderGeometryRaw because it's easier and because the signature of
-        // the SDL_RenderGeometryRaw function is different in SDL 2.0.18 and SDL >= 2.0.20
-        static_assert(sizeof(int) == sizeof(unsigned int), "Size of 'int' and 'unsigned int' must be identical for cast to work");
-        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
-        SDL_RenderGeometry(m_renderer, textureSDL,
-                           reinterpret_cast<const SDL_Vertex*>(verticesSDL.data()), static_cast<int>(vertexCount),
-                           reinterpret_cast<const int*>(indices), static_cast<int>(indexCount));
+        // Clearing the vectors keeps their memory, so no allocations are needed in the next frame
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+        m_batchTexture = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetSDL::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        // The clipping rectangle only affects geometry that is passed to SDL after it is changed
+        flushBatch();
+
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
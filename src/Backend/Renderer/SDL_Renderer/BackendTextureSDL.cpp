@@ -121,6 +121,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updatePixels(const UIntRect& rect, const std::uint8_t* pixels)
+    {
+        if (!BackendTexture::updatePixels(rect, pixels))
+            return false;
+
+        if (!m_texture)
+            return false;
+
+        const SDL_Rect sdlRect{static_cast<int>(rect.left), static_cast<int>(rect.top), static_cast<int>(rect.width), static_cast<int>(rect.height)};
+        SDL_UpdateTexture(m_texture, &sdlRect, pixels, static_cast<int>(rect.width * 4));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -148,6 +163,7 @@ namespace tgui
 
         m_texture = texture;
         m_pixels = nullptr;
+        m_transparencyMask = nullptr;
 
         int width;
         int height;
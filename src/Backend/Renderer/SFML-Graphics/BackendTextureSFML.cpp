@@ -62,6 +62,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updatePixels(const UIntRect& rect, const std::uint8_t* pixels)
+    {
+        if (!BackendTexture::updatePixels(rect, pixels))
+            return false;
+
+#if SFML_VERSION_MAJOR >= 3
+        m_texture.update(pixels, {rect.width, rect.height}, {rect.left, rect.top});
+#else
+        m_texture.update(pixels, rect.width, rect.height, rect.left, rect.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
@@ -89,6 +104,7 @@ namespace tgui
         m_texture = texture;
 
         m_pixels = nullptr;
+        m_transparencyMask = nullptr;
         m_imageSize = {texture.getSize().x, texture.getSize().y};
         m_isSmooth = texture.isSmooth();
     }
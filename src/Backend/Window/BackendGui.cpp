@@ -28,6 +28,13 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <exception>
+    #include <memory>
+    #include <vector>
+    #include <set>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -54,6 +61,14 @@ namespace tgui
 
         if (isBackendSet())
             getBackend()->detatchGui(this);
+
+        // Functions that were posted but never called are destroyed without calling them
+        PostedFunction* node = m_postedFunctions.exchange(nullptr, std::memory_order_acquire);
+        while (node)
+        {
+            std::unique_ptr<PostedFunction> ownedNode{node};
+            node = node->next;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +121,18 @@ namespace tgui
 
     bool BackendGui::handleEvent(Event event)
     {
+        if (m_mouseMoveCoalescingEnabled)
+        {
+            if (event.type == Event::Type::MouseMoved)
+            {
+                m_pendingMouseMoves.emplace_back(event.mouseMove.x, event.mouseMove.y);
+                return false;
+            }
+
+            // Mouse moves that happened before this event have to reach the widgets first
+            processCoalescedMouseMoves();
+        }
+
         switch (event.type)
         {
             case Event::Type::MouseMoved:
@@ -118,6 +145,7 @@ namespace tgui
                 {
                     m_lastMousePos = {event.mouseMove.x, event.mouseMove.y};
                     mouseCoords = mapPixelToCoords({event.mouseMove.x, event.mouseMove.y});
+                    m_coalescedMousePositions.assign(1, mouseCoords);
                 }
                 else if (event.type == Event::Type::MouseWheelScrolled)
                 {
@@ -130,19 +158,7 @@ namespace tgui
                     mouseCoords = mapPixelToCoords({event.mouseButton.x, event.mouseButton.y});
                 }
 
-                // If a tooltip is visible then hide it now
-                if (m_visibleToolTip != nullptr)
-                {
-                    // Correct the position of the tool tip so that it is relative again
-                    m_visibleToolTip->setPosition(m_toolTipRelativePos);
-
-                    remove(m_visibleToolTip);
-                    m_visibleToolTip = nullptr;
-                }
-
-                // Reset the data for the tooltip since the mouse has moved
-                m_tooltipTime = {};
-                m_tooltipPossible = true;
+                resetToolTip();
 
                 if (event.type == Event::Type::MouseMoved)
                     return m_container->processMouseMoveEvent(mouseCoords);
@@ -507,9 +523,14 @@ namespace tgui
     {
         const auto timePointNow = std::chrono::steady_clock::now();
 
-        bool screenRefreshRequired = false;
+        // The hover state of widgets may change when the stored mouse moves are processed
+        bool screenRefreshRequired = !m_pendingMouseMoves.empty();
+        processCoalescedMouseMoves();
+
         if (m_lastUpdateTime > std::chrono::steady_clock::time_point())
-            screenRefreshRequired = updateTime(timePointNow - m_lastUpdateTime);
+            screenRefreshRequired |= updateTime(timePointNow - m_lastUpdateTime);
+        else
+            screenRefreshRequired |= invokePostedFunctions();
 
         m_lastUpdateTime = timePointNow;
         return screenRefreshRequired;
@@ -519,7 +540,8 @@ namespace tgui
 
     bool BackendGui::updateTime(Duration elapsedTime)
     {
-        bool screenRefreshRequired = Timer::updateTime(elapsedTime);
+        bool screenRefreshRequired = invokePostedFunctions();
+        screenRefreshRequired |= Timer::updateTime(elapsedTime);
 
         if (!m_windowFocused)
             return screenRefreshRequired;
@@ -563,6 +585,95 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::post(std::function<void()> func)
+    {
+        pushPostedFunction(new PostedFunction{nullptr, std::move(func), 0, false});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::post(std::function<void()> func, std::uint64_t coalesceKey)
+    {
+        pushPostedFunction(new PostedFunction{nullptr, std::move(func), coalesceKey, true});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::pushPostedFunction(PostedFunction* node)
+    {
+        // Lock-free push to the front of the list. Multiple threads may be posting at the same time, while the gui thread
+        // can only ever take the whole list, so there is no risk of a node being removed while we are inserting.
+        node->next = m_postedFunctions.load(std::memory_order_relaxed);
+        while (!m_postedFunctions.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+
+        wakeUpMainLoop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::invokePostedFunctions()
+    {
+        PostedFunction* node = m_postedFunctions.exchange(nullptr, std::memory_order_acquire);
+        if (!node)
+            return false;
+
+        // The list starts with the function that was posted last. When walking over it we can thus drop every coalesced
+        // function whose key was already encountered, as a newer function with the same key exists.
+        std::vector<std::unique_ptr<PostedFunction>> functions;
+        std::set<std::uint64_t> coalesceKeys;
+        while (node)
+        {
+            std::unique_ptr<PostedFunction> ownedNode{node};
+            node = node->next;
+
+            if (!ownedNode->coalesce || coalesceKeys.insert(ownedNode->coalesceKey).second)
+                functions.push_back(std::move(ownedNode));
+        }
+
+        // Call the functions in the order in which they were posted. The functions were already removed from the list, so when
+        // one of them throws we still call the remaining functions before passing the first exception on to the caller.
+        std::exception_ptr exception;
+        for (auto it = functions.rbegin(); it != functions.rend(); ++it)
+        {
+            try
+            {
+                (*it)->func();
+            }
+            catch (...)
+            {
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::waitForPostedFunctions(Duration timeout)
+    {
+        // Posting doesn't lock the mutex, so a notification can be missed if it arrives right before we start waiting.
+        // In that case we simply wake up when the timeout expires, which is never long as the main loops pass small timeouts.
+        std::unique_lock<std::mutex> lock(m_postedFunctionsMutex);
+        m_postedFunctionsCondition.wait_for(lock, std::chrono::nanoseconds(timeout),
+                                            [this]{ return m_postedFunctions.load(std::memory_order_acquire) != nullptr; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::wakeUpMainLoop()
+    {
+        m_postedFunctionsCondition.notify_one();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f BackendGui::mapPixelToCoords(Vector2i pixel) const
     {
         return {((pixel.x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
@@ -579,21 +690,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::resetToolTip()
+    {
+        // If a tooltip is visible then hide it now
+        if (m_visibleToolTip != nullptr)
+        {
+            // Correct the position of the tool tip so that it is relative again
+            m_visibleToolTip->setPosition(m_toolTipRelativePos);
+
+            remove(m_visibleToolTip);
+            m_visibleToolTip = nullptr;
+        }
+
+        // Reset the data for the tooltip since the mouse has moved
+        m_tooltipTime = {};
+        m_tooltipPossible = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendGui::handleTwoFingerScroll(bool wasAlreadyScrolling)
     {
         TGUI_ASSERT(m_twoFingerScroll.isScrolling(), "m_twoFingerScroll.isScrolling() must return true when BackendGui::handleTwoFingerScroll is called");
 
         if (!wasAlreadyScrolling)
         {
-            // If a tooltip is visible then hide it now
-            if (m_visibleToolTip != nullptr)
-            {
-                // Correct the position of the tool tip so that it is relative again
-                m_visibleToolTip->setPosition(m_toolTipRelativePos);
-
-                remove(m_visibleToolTip);
-                m_visibleToolTip = nullptr;
-            }
+            // Hide the tooltip and don't show a new one while scrolling
+            resetToolTip();
             m_tooltipPossible = false;
 
             // In case the touch of the first finger caused a widget to respond, we tell widgets the mouse isn't down on them
@@ -665,6 +788,48 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setMouseMoveCoalescingEnabled(bool enabled)
+    {
+        if (!enabled)
+            processCoalescedMouseMoves();
+
+        m_mouseMoveCoalescingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isMouseMoveCoalescingEnabled() const
+    {
+        return m_mouseMoveCoalescingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::processCoalescedMouseMoves()
+    {
+        if (m_pendingMouseMoves.empty())
+            return false;
+
+        m_coalescedMousePositions.clear();
+        for (const auto& pixel : m_pendingMouseMoves)
+            m_coalescedMousePositions.push_back(mapPixelToCoords(pixel));
+
+        m_lastMousePos = m_pendingMouseMoves.back();
+        m_pendingMouseMoves.clear();
+
+        resetToolTip();
+        return m_container->processMouseMoveEvent(m_coalescedMousePositions.back());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vector2f>& BackendGui::getCoalescedMousePositions() const
+    {
+        return m_coalescedMousePositions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
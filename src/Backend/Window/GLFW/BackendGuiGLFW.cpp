@@ -501,6 +501,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiGLFW::wakeUpMainLoop()
+    {
+        BackendGui::wakeUpMainLoop();
+        glfwPostEmptyEvent(); // This function may be called from any thread
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
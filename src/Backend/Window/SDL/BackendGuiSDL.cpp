@@ -508,7 +508,7 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                waitForPostedFunctions(getTimerWakeUpTime());
             }
 
             refreshRequired = true;
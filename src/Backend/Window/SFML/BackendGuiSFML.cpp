@@ -271,7 +271,7 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                waitForPostedFunctions(getTimerWakeUpTime());
             }
 
             if (!windowOpen)
@@ -30,9 +30,12 @@
 #include <TGUI/SubwidgetContainer.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Filesystem.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <fstream>
+    #include <set>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +48,54 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Finds the image files that will be loaded by the textures in the node tree and that aren't loaded yet
+        void findImagesToPreload(const std::unique_ptr<DataIO::Node>& node, std::set<String>& filenames)
+        {
+            for (const auto& pair : node->propertyValuePairs)
+            {
+                if (!(((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Image") || (pair.first == U"Icon")))
+                    continue;
+
+                const String& value = pair.second->value;
+                if (value.empty() || viewEqualIgnoreCase(value, U"none") || viewEqualIgnoreCase(value, U"null") || viewEqualIgnoreCase(value, U"nullptr"))
+                    continue;
+
+                String filename;
+                if (value[0] != '"')
+                    filename = value;
+                else
+                {
+                    const auto endQuotePos = value.find('"', 1);
+                    if (endQuotePos == String::npos)
+                        continue;
+
+                    filename = value.substr(1, endQuotePos - 1);
+                }
+
+                // Embedded data and svg images aren't loaded from files with the ImageLoader
+                if (filename.empty() || filename.starts_with(U"data:"))
+                    continue;
+                if ((filename.length() > 4) && viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg"))
+                    continue;
+
+                // Use the same filename as Texture::load will pass to the texture loader
+#ifdef TGUI_SYSTEM_WINDOWS
+                if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.length() <= 1) || (filename[1] != ':')))
+#else
+                if (filename[0] != '/')
+#endif
+                    filename = (getResourcePath() / filename).asString();
+
+                if (!TextureManager::isImageCached(filename))
+                    filenames.insert(filename);
+            }
+
+            for (const auto& child : node->children)
+                findImagesToPreload(child, filenames);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void getAllRenderers(std::vector<RendererData*>& orderedRenderers, std::map<RendererData*, std::vector<const Widget*>>& rendererToWidgetsMap, const Container* container)
         {
             const auto addRenderer = [&](RendererData* rendererData, const Widget* widget){
@@ -170,7 +221,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget{other},
+        m_cachedAsLayer{other.m_cachedAsLayer}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -194,7 +246,11 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_cachedAsLayer           {std::move(other.m_cachedAsLayer)},
+        m_layerInvalidated        {std::move(other.m_layerInvalidated)},
+        m_layerTexture            {std::move(other.m_layerTexture)},
+        m_layerRect               {std::move(other.m_layerRect)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -231,6 +287,9 @@ namespace tgui
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
             m_draggingWidget = false;
+            m_cachedAsLayer = right.m_cachedAsLayer;
+            m_layerInvalidated = true;
+            m_layerTexture = nullptr;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -264,6 +323,10 @@ namespace tgui
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
             m_draggingWidget           = std::move(right.m_draggingWidget);
+            m_cachedAsLayer            = std::move(right.m_cachedAsLayer);
+            m_layerInvalidated         = std::move(right.m_layerInvalidated);
+            m_layerTexture             = std::move(right.m_layerTexture);
+            m_layerRect                = std::move(right.m_layerRect);
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -283,6 +346,8 @@ namespace tgui
 
     void Container::setSize(const Layout2d& size)
     {
+        invalidateLayer();
+
         if (size.getValue() != m_prevSize)
         {
             Widget::setSize(size);
@@ -312,6 +377,7 @@ namespace tgui
             widgetPtr->setWidgetName(widgetName);
 
         widgetAdded(widgetPtr);
+        invalidateLayer();
 
         if (widgetPtr->getAutoLayout() != AutoLayout::Manual)
             updateChildrenWithAutoLayout();
@@ -395,6 +461,7 @@ namespace tgui
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidateLayer();
 
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
@@ -422,6 +489,7 @@ namespace tgui
         m_widgetWithRightMouseDown = nullptr;
         m_focusedWidget = nullptr;
         m_draggingWidget = false;
+        invalidateLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -459,9 +527,11 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open '" + filenameInResources + U"' to load the widgets from it."};
 
-        /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-        std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        std::unique_ptr<DataIO::Node> rootNode;
+        if (DataIO::isBinary(fileContents.get(), fileSize))
+            rootNode = DataIO::parseBinary(fileContents.get(), fileSize);
+        else
+            rootNode = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -528,6 +598,13 @@ namespace tgui
         if (rootNode->propertyValuePairs.size() != 0)
             Widget::load(rootNode, {});
 
+        // Decode the images that are used in the form on multiple threads before the widgets are created.
+        // The widgets themselves are still created and loaded sequentially.
+        std::set<String> imagesToPreloadSet;
+        findImagesToPreload(rootNode, imagesToPreloadSet);
+        const std::vector<String> imagesToPreload(imagesToPreloadSet.begin(), imagesToPreloadSet.end());
+        ImageLoader::preloadFiles(imagesToPreload);
+
         std::vector<std::pair<Widget::Ptr, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>> widgetsToLoad;
         std::map<String, std::shared_ptr<RendererData>> availableRenderers;
         for (const auto& node : rootNode->children)
@@ -558,16 +635,31 @@ namespace tgui
                     widgetsToLoad.emplace_back(widget, std::cref(node));
                 }
                 else
+                {
+                    ImageLoader::releasePreloadedFiles(imagesToPreload);
                     throw Exception{U"No construct function exists for widget type '" + widgetType + U"'."};
+                }
             }
         }
 
-        for (auto& pair : widgetsToLoad)
+        try
+        {
+            for (auto& pair : widgetsToLoad)
+            {
+                Widget::Ptr& widget = pair.first;
+                const auto& node = pair.second.get();
+                widget->load(node, availableRenderers);
+            }
+        }
+        catch (...)
         {
-            Widget::Ptr& widget = pair.first;
-            const auto& node = pair.second.get();
-            widget->load(node, availableRenderers);
+            ImageLoader::releasePreloadedFiles(imagesToPreload);
+            throw;
         }
+
+        // Free the images that weren't used (e.g. because a texture loader was set that doesn't use the ImageLoader).
+        // Images preloaded by a container that is loading this one are kept, as they are released by that container.
+        ImageLoader::releasePreloadedFiles(imagesToPreload);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,6 +724,7 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
 
+            invalidateLayer();
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
 
@@ -656,6 +749,7 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i + 1));
 
+            invalidateLayer();
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
 
@@ -678,6 +772,7 @@ namespace tgui
 
             std::swap(m_widgets[i], m_widgets[i+1]);
 
+            invalidateLayer();
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
 
@@ -703,6 +798,7 @@ namespace tgui
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
 
+            invalidateLayer();
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
 
@@ -739,6 +835,7 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+        invalidateLayer();
 
         if (widget->getAutoLayout() != AutoLayout::Manual)
             updateChildrenWithAutoLayout();
@@ -1019,6 +1116,7 @@ namespace tgui
         {
             m_widgetBelowMouse->mouseNoLongerOnWidget();
             m_widgetBelowMouse = nullptr;
+            invalidateLayer();
         }
     }
 
@@ -1033,6 +1131,7 @@ namespace tgui
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
             m_draggingWidget = false;
+            invalidateLayer();
         }
     }
 
@@ -1046,6 +1145,7 @@ namespace tgui
         {
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
+            invalidateLayer();
         }
     }
 
@@ -1158,6 +1258,7 @@ namespace tgui
         if (m_widgetWithLeftMouseDown && m_draggingWidget)
         {
             m_widgetWithLeftMouseDown->mouseMoved(transformMousePos(m_widgetWithLeftMouseDown, mousePos));
+            invalidateLayer();
             return true;
         }
 
@@ -1169,6 +1270,7 @@ namespace tgui
         {
             // Send the event to the widget
             widget->mouseMoved(transformMousePos(widget, mousePos));
+            invalidateLayer();
             return true;
         }
 
@@ -1176,7 +1278,10 @@ namespace tgui
         // event as handled by TGUI. In backends that only redraw when handleEvent returns true, this is required to update the
         // widget now that it is no longer in hover state.
         if (!m_widgetBelowMouse && oldWidgetBelowMouse)
+        {
+            invalidateLayer();
             return true;
+        }
 
         return false;
     }
@@ -1185,6 +1290,8 @@ namespace tgui
 
     bool Container::processMousePressEvent(Event::MouseButton button, Vector2f mousePos)
     {
+        invalidateLayer();
+
         // Check if the mouse is on top of a widget
         Widget::Ptr widget = updateWidgetBelowMouse(mousePos);
         if (widget)
@@ -1234,6 +1341,8 @@ namespace tgui
 
     bool Container::processMouseReleaseEvent(Event::MouseButton button, Vector2f mousePos)
     {
+        invalidateLayer();
+
         Widget::Ptr widgetBelowMouse = updateWidgetBelowMouse(mousePos);
         if (widgetBelowMouse != nullptr)
             widgetBelowMouse->mouseReleased(button, transformMousePos(widgetBelowMouse, mousePos));
@@ -1263,7 +1372,10 @@ namespace tgui
         Widget::Ptr widget = updateWidgetBelowMouse(pos);
 
         if (widget != nullptr)
+        {
+            invalidateLayer();
             return widget->scrolled(delta, transformMousePos(widget, pos), touch);
+        }
 
         return false;
     }
@@ -1279,6 +1391,8 @@ namespace tgui
         // Check if there is a focused widget
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
+            invalidateLayer();
+
             // Tell the widget that the key was pressed
             const bool bHandled = m_focusedWidget->canHandleKeyPress(event); // TGUI_NEXT: Have keyPressed return a bool
             m_focusedWidget->keyPressed(event); // Called even if bHandled is false for backwards compatibility
@@ -1323,6 +1437,7 @@ namespace tgui
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
             m_focusedWidget->textEntered(key);
+            invalidateLayer();
             return true;
         }
 
@@ -1343,6 +1458,9 @@ namespace tgui
                 screenRefreshRequired |= widget->updateTime(elapsedTime);
         }
 
+        if (screenRefreshRequired)
+            invalidateLayer();
+
         return screenRefreshRequired;
     }
 
@@ -1508,32 +1626,99 @@ namespace tgui
 
     void Container::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        for (const auto& widget : m_widgets)
+        if (m_cachedAsLayer)
         {
-            if (!widget->isVisible())
-                continue;
+            const FloatRect layerRect{getLayerOffset(), getInnerSize()};
+            if (layerRect != m_layerRect)
+            {
+                m_layerRect = layerRect;
+                m_layerInvalidated = true;
+            }
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+            // The texture has to be rendered again when the container got scaled or the view changed
+            if (m_layerTexture && (m_layerTexture->getSize() != target.getLayerPixelSize(states, layerRect.getSize())))
+                m_layerInvalidated = true;
 
-            RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
+            if (m_layerInvalidated && target.beginLayer(states, m_layerTexture, layerRect.getSize()))
             {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
+                RenderStates layerStates;
+                layerStates.transform.translate(-layerRect.getPosition());
+                for (const auto& widget : m_widgets)
+                {
+                    if (!widget->isVisible())
+                        continue;
+
+                    RenderStates widgetStates = layerStates;
+                    widgetStates.transform.combine(widget->getTransform());
+                    target.drawWidget(widgetStates, widget);
+                }
+
+                target.endLayer();
+                m_layerInvalidated = false;
             }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
+
+            if (!m_layerInvalidated)
             {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
+                states.transform.translate(layerRect.getPosition());
+                target.drawLayer(states, m_layerTexture, layerRect.getSize());
+                return;
             }
+        }
 
+        for (const auto& widget : m_widgets)
+        {
+            if (!widget->isVisible())
+                continue;
+
+            RenderStates widgetStates = states;
+            widgetStates.transform.combine(widget->getTransform());
             target.drawWidget(widgetStates, widget);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Vector2f Container::getLayerOffset() const
+    {
+        return {0, 0};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setCachedAsLayer(bool cached)
+    {
+        m_cachedAsLayer = cached;
+        m_layerInvalidated = true;
+        if (!cached)
+            m_layerTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isCachedAsLayer() const
+    {
+        return m_cachedAsLayer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateLayer()
+    {
+        if (m_cachedAsLayer)
+        {
+            // Containers that contain an outdated layer are already outdated themselves
+            if (m_layerInvalidated)
+                return;
+
+            m_layerInvalidated = true;
+        }
+
+        if (m_parent)
+            m_parent->invalidateLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t Container::getFocusedWidgetIndex() const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -1597,15 +1782,7 @@ namespace tgui
         if (!scaledOrRotated)
             return mousePos + origin;
 
-        const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-        const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-
-        Transform transform;
-        transform.translate(widget->getPosition() - origin);
-        transform.rotate(widget->getRotation(), rotOrigin);
-        transform.scale(widget->getScale(), scaleOrigin);
-        mousePos = transform.getInverse().transformPoint(mousePos);
-        return mousePos + widget->getPosition();
+        return widget->getInverseTransform().transformPoint(mousePos) + widget->getPosition();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdlib> // getenv
+    #include <limits>
 #endif
 
 #if defined(TGUI_SYSTEM_WINDOWS)
@@ -38,8 +39,8 @@
 
     #if !defined(TGUI_USE_STD_FILESYSTEM) || !defined(TGUI_USE_STD_FILESYSTEM_FILE_TIME)
         #include <sys/types.h> // stat
-        #include <sys/stat.h> // stat
-        #include <dirent.h> // opendir, readdir, closedir
+        #include <sys/stat.h> // stat, fstatat
+        #include <dirent.h> // opendir, readdir, closedir, dirfd
         #include <cerrno> // errno
     #endif
 #endif
@@ -469,6 +470,30 @@ namespace tgui
     std::vector<Filesystem::FileInfo> Filesystem::listFilesInDirectory(const Path& path)
     {
         std::vector<FileInfo> fileList;
+        listFilesInDirectory(path, std::numeric_limits<std::size_t>::max(), [&fileList](std::vector<FileInfo>&& files){
+            fileList = std::move(files);
+            return true;
+        });
+        return fileList;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Filesystem::listFilesInDirectory(const Path& path, std::size_t chunkSize, const std::function<bool(std::vector<FileInfo>&& files)>& chunkFunc)
+    {
+        TGUI_ASSERT(chunkSize > 0, "chunkSize can't be 0 in Filesystem::listFilesInDirectory");
+
+        std::vector<FileInfo> fileList;
+
+        // Passes the entries that were found to the callback when the chunk is full (or when force is true)
+        const auto flushChunk = [&fileList,chunkSize,&chunkFunc](bool force){
+            if (fileList.empty() || (!force && (fileList.size() < chunkSize)))
+                return true;
+
+            const bool continueListing = chunkFunc(std::move(fileList));
+            fileList.clear();
+            return continueListing;
+        };
 
 #ifdef TGUI_USE_STD_FILESYSTEM_FILE_TIME
         std::error_code errorCode;
@@ -481,12 +506,15 @@ namespace tgui
             fileInfo.modificationTime = std::chrono::system_clock::to_time_t(std::chrono::clock_cast<std::chrono::system_clock>(entry.last_write_time(errorCode)));
             if (!fileInfo.directory)
                 fileInfo.fileSize = entry.file_size(errorCode);
+
+            if (!flushChunk(false))
+                return false;
         }
 #elif defined(TGUI_SYSTEM_WINDOWS)
         WIN32_FIND_DATAW entry;
         HANDLE FileHandle = FindFirstFileW((path.asNativeString() + L"\\*").c_str(), &entry);
         if (FileHandle == INVALID_HANDLE_VALUE)
-            return fileList;
+            return true;
 
         do
         {
@@ -503,13 +531,22 @@ namespace tgui
             if (!fileInfo.directory)
                 fileInfo.fileSize = (entry.nFileSizeHigh * (static_cast<decltype(fileInfo.fileSize)>(MAXDWORD) + 1)) + entry.nFileSizeLow;
 
+            if (!flushChunk(false))
+            {
+                FindClose(FileHandle);
+                return false;
+            }
         } while (FindNextFileW(FileHandle, &entry) != 0);
 
         FindClose(FileHandle);
 #else
         DIR* dir = opendir(path.asNativeString().c_str());
         if (!dir)
-            return fileList;
+            return true;
+
+        // The size and modification time of each entry are needed, so d_type alone doesn't suffice. We do however query
+        // them relative to the opened directory, which avoids resolving the full path again for every entry.
+        const int dirFd = dirfd(dir);
 
         struct dirent* entry = nullptr;
         while ((entry = readdir(dir)) != nullptr)
@@ -518,10 +555,8 @@ namespace tgui
             if ((filename == U".") || (filename == U".."))
                 continue;
 
-            const Path filePath = path / filename;
-
             struct stat statFileInfo;
-            if (stat(filePath.asNativeString().c_str(), &statFileInfo) != 0)
+            if (fstatat(dirFd, entry->d_name, &statFileInfo, 0) != 0)
                 continue;
 
             if (statFileInfo.st_size < 0)
@@ -529,17 +564,23 @@ namespace tgui
 
             TGUI_EMPLACE_BACK(fileInfo, fileList)
             fileInfo.filename = filename;
-            fileInfo.path = filePath;
+            fileInfo.path = path / filename;
             fileInfo.directory = (statFileInfo.st_mode & S_IFDIR);
             fileInfo.modificationTime = statFileInfo.st_mtime;
             if (!fileInfo.directory)
                 fileInfo.fileSize = static_cast<decltype(fileInfo.fileSize)>(statFileInfo.st_size);
+
+            if (!flushChunk(false))
+            {
+                closedir(dir);
+                return false;
+            }
         }
 
         closedir(dir);
 #endif
 
-        return fileList;
+        return flushChunk(true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
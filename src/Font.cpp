@@ -195,6 +195,60 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::setDistanceFieldEnabled(bool enabled)
+    {
+        if (m_backendFont)
+            m_backendFont->setDistanceFieldEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isDistanceFieldEnabled() const
+    {
+        if (m_backendFont)
+            return m_backendFont->isDistanceFieldEnabled();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preload(const String& characters, const std::vector<unsigned int>& characterSizes, TextStyles style)
+    {
+        if (m_backendFont)
+            m_backendFont->preload(characters, characterSizes, style);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isPreloading() const
+    {
+        if (m_backendFont)
+            return m_backendFont->isPreloading();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setGlyphCacheDirectory(const String& directory)
+    {
+        if (m_backendFont)
+            m_backendFont->setGlyphCacheDirectory(directory);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String Font::getGlyphCacheDirectory() const
+    {
+        if (m_backendFont)
+            return m_backendFont->getGlyphCacheDirectory();
+        else
+            return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<BackendFont> Font::getBackendFont() const
     {
         return m_backendFont;
@@ -39,7 +39,7 @@
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
+        stream.skipWhitespace(); \
         if (stream.peek() == EOF) \
             break; \
         \
@@ -95,77 +95,144 @@ namespace tgui
 {
     namespace
     {
+        // Input of the parser, which reads directly from the buffer that was passed to DataIO::parse
+        struct InputBuffer
+        {
+            InputBuffer(const char* data, std::size_t size) :
+                begin{data},
+                pos{data},
+                end{data + size}
+            {
+            }
+
+            TGUI_NODISCARD int peek() const
+            {
+                return (pos != end) ? static_cast<unsigned char>(*pos) : EOF;
+            }
+
+            void read(char* c, std::size_t count)
+            {
+                for (; (count > 0) && (pos != end); --count)
+                    *c++ = *pos++;
+            }
+
+            void skipWhitespace()
+            {
+                while ((pos != end) && std::isspace(static_cast<unsigned char>(*pos)))
+                    ++pos;
+            }
+
+            const char* const begin;
+            const char* pos;
+            const char* const end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
+        String parseSection(InputBuffer& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readWord(std::stringstream& stream)
+        bool isWordDelimiter(char c)
         {
-            String word = "";
-            while (stream.peek() != EOF)
+            return std::isspace(static_cast<unsigned char>(c)) || (c == '=') || (c == ';') || (c == ':') || (c == '{') || (c == '}');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isValueDelimiter(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) || (c == '/') || (c == '"') || (c == '=') || (c == '{') || (c == ';') || (c == '}');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the position behind the closing quote, pos has to point to the character behind the opening quote
+        const char* findEndOfQuotedString(const char* pos, const char* end)
+        {
+            bool backslash = false;
+            while (pos != end)
             {
-                char c = static_cast<char>(stream.peek());
+                const char c = *pos++;
+                if ((c == '"') && !backslash)
+                    break;
+
+                if ((c == '\\') && !backslash)
+                    backslash = true;
+                else
+                    backslash = false;
+            }
+
+            return pos;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the position behind the "*/" that ends a comment, pos has to point to the character behind the "/*"
+        const char* findEndOfBlockComment(const char* pos, const char* end)
+        {
+            while (pos != end)
+            {
+                pos = std::find(pos, end, '*');
+                if (pos == end)
+                    break;
+
+                ++pos;
+                if ((pos != end) && (*pos == '/'))
+                    return pos + 1;
+            }
+
+            return end;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        String readWord(InputBuffer& stream)
+        {
+            std::string word;
+            while (stream.pos != stream.end)
+            {
+                // Copy all characters without a special meaning at once
+                const char* const wordPartStart = stream.pos;
+                while ((stream.pos != stream.end) && !isWordDelimiter(*stream.pos) && (*stream.pos != '/') && (*stream.pos != '"'))
+                    ++stream.pos;
+
+                word.append(wordPartStart, stream.pos);
+                if (stream.pos == stream.end)
+                    break;
+
+                const char c = *stream.pos;
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
-                    return word;
+                    ++stream.pos;
+                    return String(word);
                 }
-                else if (!std::isspace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}'))
-                {
-                    stream.read(&c, 1);
+                else if (isWordDelimiter(c))
+                    return String(word);
 
-                    if ((c == '/') && (stream.peek() == '/'))
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
-                                                           "(comment would have been skipped earlier)");
-                                return word;
-                            }
-                        }
-                    }
-                    else if ((c == '/') && (stream.peek() == '*'))
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '*')
-                            {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    else if (c == '"')
+                ++stream.pos;
+                if ((c == '/') && (stream.peek() == '/'))
+                {
+                    stream.pos = std::find(stream.pos, stream.end, '\n');
+                    if (stream.pos != stream.end)
                     {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
+                        ++stream.pos;
+                        TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
+                                                   "(comment would have been skipped earlier)");
+                        return String(word);
                     }
-                    else
-                        word.push_back(c);
+                }
+                else if ((c == '/') && (stream.peek() == '*'))
+                    stream.pos = findEndOfBlockComment(stream.pos + 1, stream.end);
+                else if (c == '"')
+                {
+                    const char* const quotedStringEnd = findEndOfQuotedString(stream.pos, stream.end);
+                    word.append(stream.pos - 1, quotedStringEnd);
+                    stream.pos = quotedStringEnd;
                 }
                 else
-                    return word;
+                    word.push_back(c);
             }
 
             return "";
@@ -173,101 +240,68 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readLine(std::stringstream& stream)
+        String readLine(InputBuffer& stream)
         {
             std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (stream.pos != stream.end)
             {
-                char c = static_cast<char>(stream.peek());
+                // Copy all characters without a special meaning at once
+                const char* const linePartStart = stream.pos;
+                while ((stream.pos != stream.end) && !isValueDelimiter(*stream.pos))
+                    ++stream.pos;
 
+                if (stream.pos != linePartStart)
+                {
+                    whitespaceFound = false;
+                    line.append(linePartStart, stream.pos);
+                }
+
+                if (stream.pos == stream.end)
+                    break;
+
+                const char c = *stream.pos;
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
+                    ++stream.pos;
                     if (stream.peek() == '/')
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
+                        stream.pos = std::find(stream.pos, stream.end, '\n');
+                        if (stream.pos != stream.end)
+                            ++stream.pos;
                     }
                     else if (stream.peek() == '*')
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
-                    }
+                        stream.pos = findEndOfBlockComment(stream.pos + 1, stream.end);
                     else // The slash is part of the value
                     {
                         whitespaceFound = false;
                         line.push_back(c);
                     }
-
-                    continue;
                 }
-
-                if (c == '"')
+                else if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
-
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
-
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
-                        return "";
-
-                    c = static_cast<char>(stream.peek());
+                    const char* const quotedStringEnd = findEndOfQuotedString(stream.pos + 1, stream.end);
+                    line.append(stream.pos, quotedStringEnd);
+                    stream.pos = quotedStringEnd;
+                    whitespaceFound = false;
                 }
-
-                if ((c == '=') || (c == '{'))
+                else if ((c == '=') || (c == '{'))
                     return "";
                 else if ((c == ';') || (c == '}'))
                 {
                     // Remove trailing whitespace before returning the line
                     line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
+                    return String(line);
                 }
-                else if (::isspace(c))
+                else // Whitespace
                 {
-                    stream.read(&c, 1);
+                    ++stream.pos;
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
                         line.push_back(' ');
                     }
                 }
-                else
-                {
-                    whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
-                }
             }
 
             return "";
@@ -275,7 +309,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
+        String parseKeyValue(InputBuffer& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
         {
             // Read the assignment symbol from the stream and remove the whitespace behind it
             char chr;
@@ -305,27 +339,22 @@ namespace tgui
                     valueNode->listNode = true;
                     if (line.size() >= 3)
                     {
-                        valueNode->valueList.emplace_back("");
-
+                        std::size_t itemStart = 1;
                         std::size_t i = 1;
                         while (i < line.size()-1)
                         {
                             if (line[i] == ',')
                             {
-                                i++;
-                                valueNode->valueList.back() = valueNode->valueList.back().trim();
-                                valueNode->valueList.emplace_back("");
+                                valueNode->valueList.push_back(line.substr(itemStart, i - itemStart).trim());
+                                itemStart = ++i;
                             }
                             else if (line[i] == '"')
                             {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
                                 i++;
 
                                 bool backslash = false;
                                 while (i < line.size()-1)
                                 {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-
                                     if (line[i] == '"' && !backslash)
                                     {
                                         i++;
@@ -341,13 +370,10 @@ namespace tgui
                                 }
                             }
                             else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
                                 i++;
-                            }
                         }
 
-                        valueNode->valueList.back() = valueNode->valueList.back().trim();
+                        valueNode->valueList.push_back(line.substr(itemStart, line.size() - 1 - itemStart).trim());
                     }
                 }
 
@@ -373,7 +399,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseInheritance(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseInheritance(InputBuffer& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
         {
             // Read the colon from the stream
             char chr;
@@ -435,7 +461,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseSection(InputBuffer& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
@@ -501,7 +527,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        String parseRootSection(InputBuffer& stream, std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
@@ -565,29 +591,242 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Header of the binary format: a null byte (which can't occur in a text file) followed by an identifier and a version
+        const std::uint8_t binaryMagic[] = {0x00, 'T', 'G', 'U', 'I', 'B', 'I', 'N'};
+        constexpr std::uint8_t binaryVersion = 1;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinaryNumber(std::stringstream& stream, std::size_t value)
+        {
+            // Variable-length encoding, 7 bits per byte with the highest bit set when more bytes follow
+            while (value >= 0x80)
+            {
+                stream.put(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            stream.put(static_cast<char>(value));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct BinaryStringTable
+        {
+            std::size_t getIndex(const String& str)
+            {
+                const auto it = indices.find(str);
+                if (it != indices.end())
+                    return it->second;
+
+                indices[str] = strings.size();
+                strings.push_back(&str);
+                return strings.size() - 1;
+            }
+
+            std::map<String, std::size_t> indices;
+            std::vector<const String*> strings;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectBinaryStrings(const DataIO::Node& node, BinaryStringTable& table)
+        {
+            (void)table.getIndex(node.name);
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                (void)table.getIndex(pair.first);
+                (void)table.getIndex(pair.second->value);
+                for (const auto& item : pair.second->valueList)
+                    (void)table.getIndex(item);
+            }
+
+            for (const auto& child : node.children)
+                collectBinaryStrings(*child, table);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinaryNode(std::stringstream& stream, const DataIO::Node& node, BinaryStringTable& table)
+        {
+            writeBinaryNumber(stream, table.getIndex(node.name));
+
+            writeBinaryNumber(stream, node.propertyValuePairs.size());
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                writeBinaryNumber(stream, table.getIndex(pair.first));
+                stream.put(pair.second->listNode ? 1 : 0);
+                writeBinaryNumber(stream, table.getIndex(pair.second->value));
+                if (pair.second->listNode)
+                {
+                    writeBinaryNumber(stream, pair.second->valueList.size());
+                    for (const auto& item : pair.second->valueList)
+                        writeBinaryNumber(stream, table.getIndex(item));
+                }
+            }
+
+            writeBinaryNumber(stream, node.children.size());
+            for (const auto& child : node.children)
+                writeBinaryNode(stream, *child, table);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        class BinaryReader
+        {
+        public:
+            BinaryReader(const std::uint8_t* data, std::size_t size) :
+                m_data{data},
+                m_end{data + size}
+            {
+            }
+
+            std::size_t readNumber()
+            {
+                std::size_t value = 0;
+                unsigned int shift = 0;
+                for (;;)
+                {
+                    if (m_data == m_end)
+                        throw Exception{U"Error while parsing binary input. Unexpected end of data."};
+                    if (shift >= sizeof(std::size_t) * 8)
+                        throw Exception{U"Error while parsing binary input. Number is too large."};
+
+                    // The last byte may only contain the bits that still fit in the value
+                    const std::uint8_t byte = *m_data++;
+                    const std::size_t bits = static_cast<std::size_t>(byte & 0x7F);
+                    if (((bits << shift) >> shift) != bits)
+                        throw Exception{U"Error while parsing binary input. Number is too large."};
+
+                    value |= bits << shift;
+                    if ((byte & 0x80) == 0)
+                        return value;
+
+                    shift += 7;
+                }
+            }
+
+            std::uint8_t readByte()
+            {
+                if (m_data == m_end)
+                    throw Exception{U"Error while parsing binary input. Unexpected end of data."};
+
+                return *m_data++;
+            }
+
+            // The count is validated against the remaining bytes, so that corrupt data can't cause huge allocations
+            std::size_t readCount()
+            {
+                const std::size_t count = readNumber();
+                if (count > getRemainingSize())
+                    throw Exception{U"Error while parsing binary input. Invalid element count."};
+
+                return count;
+            }
+
+            const char* readBytes(std::size_t count)
+            {
+                if (count > getRemainingSize())
+                    throw Exception{U"Error while parsing binary input. Unexpected end of data."};
+
+                const char* bytes = reinterpret_cast<const char*>(m_data);
+                m_data += count;
+                return bytes;
+            }
+
+            TGUI_NODISCARD std::size_t getRemainingSize() const
+            {
+                return static_cast<std::size_t>(m_end - m_data);
+            }
+
+        private:
+            const std::uint8_t* m_data;
+            const std::uint8_t* m_end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const String& readBinaryString(BinaryReader& reader, const std::vector<String>& strings)
+        {
+            const std::size_t index = reader.readNumber();
+            if (index >= strings.size())
+                throw Exception{U"Error while parsing binary input. Invalid string index."};
+
+            return strings[index];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void readBinaryNode(BinaryReader& reader, const std::vector<String>& strings, DataIO::Node& node, unsigned int depth)
+        {
+            // Limit the recursion so that corrupt data can't overflow the stack
+            if (depth > 256)
+                throw Exception{U"Error while parsing binary input. Sections are nested too deep."};
+
+            node.name = readBinaryString(reader, strings);
+
+            const std::size_t propertyCount = reader.readCount();
+            for (std::size_t i = 0; i < propertyCount; ++i)
+            {
+                const String& key = readBinaryString(reader, strings);
+                const std::uint8_t flags = reader.readByte();
+
+                auto valueNode = std::make_unique<DataIO::ValueNode>(readBinaryString(reader, strings));
+                if (flags & 1)
+                {
+                    valueNode->listNode = true;
+
+                    const std::size_t listSize = reader.readCount();
+                    valueNode->valueList.reserve(listSize);
+                    for (std::size_t j = 0; j < listSize; ++j)
+                        valueNode->valueList.push_back(readBinaryString(reader, strings));
+                }
+
+                node.propertyValuePairs[key] = std::move(valueNode);
+            }
+
+            const std::size_t childCount = reader.readCount();
+            node.children.reserve(childCount);
+            for (std::size_t i = 0; i < childCount; ++i)
+            {
+                auto child = std::make_unique<DataIO::Node>();
+                child->parent = &node;
+                readBinaryNode(reader, strings, *child, depth + 1);
+                node.children.push_back(std::move(child));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        // Parse the part of the stream that hasn't been read yet and mark the stream as fully read
+        const std::string contents = stream.str();
+        const auto position = stream.tellg();
+        if ((position == std::stringstream::pos_type(-1)) || (static_cast<std::size_t>(position) >= contents.size()))
+            return std::make_unique<Node>();
+
+        stream.seekg(0, std::ios_base::end);
+        return parse(CharStringView{contents.data() + static_cast<std::size_t>(position), contents.size() - static_cast<std::size_t>(position)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(CharStringView data)
     {
         auto root = std::make_unique<Node>();
 
-        String error;
+        InputBuffer stream{data.data(), data.size()};
         while (stream.peek() != EOF)
         {
-            error = parseRootSection(stream, root);
+            const String error = parseRootSection(stream, root);
             if (!error.empty())
             {
-                const auto position = stream.tellg();
-                if (position != std::stringstream::pos_type(-1))
-                {
-                    String str = stream.str();
-                    auto lineNumber = std::count(str.begin(), str.begin() + static_cast<std::ptrdiff_t>(position), U'\n') + 1;
-                    throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
-                }
-                else
-                    throw Exception{U"Error while parsing input. " + error};
+                const auto lineNumber = std::count(stream.begin, stream.pos, '\n') + 1;
+                throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
             }
         }
 
@@ -619,6 +858,69 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parseBinary(const std::uint8_t* data, std::size_t size)
+    {
+        if (!isBinary(data, size))
+            throw Exception{U"Error while parsing binary input. Data does not start with the expected header."};
+
+        BinaryReader reader{data + sizeof(binaryMagic), size - sizeof(binaryMagic)};
+        const std::uint8_t version = reader.readByte();
+        if (version != binaryVersion)
+            throw Exception{U"Error while parsing binary input. Unsupported version " + String::fromNumber(static_cast<unsigned int>(version)) + U"."};
+
+        // All strings are decoded once, nodes only refer to them by index
+        const std::size_t stringCount = reader.readCount();
+        std::vector<String> strings;
+        strings.reserve(stringCount);
+        for (std::size_t i = 0; i < stringCount; ++i)
+        {
+            const std::size_t length = reader.readNumber();
+            const char* bytes = reader.readBytes(length);
+            strings.emplace_back(bytes, length);
+        }
+
+        auto root = std::make_unique<Node>();
+        readBinaryNode(reader, strings, *root, 0);
+
+        if (reader.getRemainingSize() != 0)
+            throw Exception{U"Error while parsing binary input. Unexpected data after the end of the root node."};
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    {
+        BinaryStringTable table;
+        collectBinaryStrings(*rootNode, table);
+
+        stream.write(reinterpret_cast<const char*>(binaryMagic), sizeof(binaryMagic));
+        stream.put(static_cast<char>(binaryVersion));
+
+        writeBinaryNumber(stream, table.strings.size());
+        for (const String* str : table.strings)
+        {
+            const std::string utf8 = str->toStdString();
+            writeBinaryNumber(stream, utf8.size());
+            stream.write(utf8.data(), static_cast<std::streamsize>(utf8.size()));
+        }
+
+        writeBinaryNode(stream, *rootNode, table);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataIO::isBinary(const std::uint8_t* data, std::size_t size)
+    {
+        if (!data || (size < sizeof(binaryMagic)))
+            return false;
+
+        return std::equal(std::begin(binaryMagic), std::end(binaryMagic), data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,15 +31,46 @@
 #endif
 
 #include <cstring> // memcpy
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct PreloadedImage
+        {
+            Vector2u size;
+            std::unique_ptr<std::uint8_t[]> pixels;
+            unsigned int preloadCount = 0; // Amount of preloadFiles calls that haven't released the image yet
+        };
+
+        // Images that were decoded by preloadFiles. Images can be loaded from any thread, so the map is protected by a mutex.
+        std::map<String, PreloadedImage> preloadedImages;
+        std::mutex preloadedImagesMutex;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
     {
+        {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            const auto it = preloadedImages.find(filename);
+            if (it != preloadedImages.end())
+            {
+                imageSize = it->second.size;
+                auto pixels = std::move(it->second.pixels);
+                preloadedImages.erase(it);
+                return pixels;
+            }
+        }
+
         std::size_t fileSize;
         auto fileContents = readFileToMemory(filename, fileSize);
         if (!fileContents)
@@ -76,6 +107,101 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::preloadFiles(const std::vector<String>& filenames)
+    {
+        // Images that are still preloaded from an earlier call don't need to be decoded again
+        std::vector<String> filesToDecode;
+        {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            for (const auto& filename : filenames)
+            {
+                const auto it = preloadedImages.find(filename);
+                if (it != preloadedImages.end())
+                    ++it->second.preloadCount;
+                else
+                    filesToDecode.push_back(filename);
+            }
+        }
+
+        decodePreloadedFiles(filesToDecode);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::decodePreloadedFiles(const std::vector<String>& filenames)
+    {
+        if (filenames.empty())
+            return;
+
+        // The worker threads only write to their own elements in the vector, the map is filled afterwards
+        std::vector<PreloadedImage> images(filenames.size());
+        std::atomic<std::size_t> nextIndex{0};
+        const auto decodeImages = [&]
+            {
+                for (std::size_t i = nextIndex++; i < filenames.size(); i = nextIndex++)
+                {
+                    std::size_t fileSize;
+                    const auto fileContents = readFileToMemory(filenames[i], fileSize);
+                    if (fileContents)
+                        images[i].pixels = loadFromMemory(fileContents.get(), fileSize, images[i].size);
+                }
+            };
+
+        const std::size_t threadCount = std::min<std::size_t>(std::thread::hardware_concurrency(), filenames.size());
+        std::vector<std::thread> threads;
+        if (threadCount > 1)
+        {
+            threads.reserve(threadCount - 1);
+            for (std::size_t i = 0; i < threadCount - 1; ++i)
+                threads.emplace_back(decodeImages);
+        }
+
+        decodeImages();
+        for (auto& thread : threads)
+            thread.join();
+
+        // Another thread may have preloaded the same image while these images were being decoded
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        for (std::size_t i = 0; i < filenames.size(); ++i)
+        {
+            if (!images[i].pixels)
+                continue;
+
+            auto& preloadedImage = preloadedImages[filenames[i]];
+            if (preloadedImage.pixels)
+                ++preloadedImage.preloadCount;
+            else
+            {
+                images[i].preloadCount = preloadedImage.preloadCount + 1;
+                preloadedImage = std::move(images[i]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::releasePreloadedFiles(const std::vector<String>& filenames)
+    {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        for (const auto& filename : filenames)
+        {
+            // The image is no longer found when it was already loaded
+            const auto it = preloadedImages.find(filename);
+            if ((it != preloadedImages.end()) && (--it->second.preloadCount == 0))
+                preloadedImages.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::clearPreloadedFiles()
+    {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        preloadedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -565,6 +565,7 @@ namespace tgui
         {
             auto data = std::make_shared<RendererData>(*pair.second);
             data->observers = {};
+            data->copyOnWriteObservers = {};
             data->connectedTheme = this;
             data->shared = true;
             m_renderers[pair.first] = data;
@@ -646,6 +647,10 @@ namespace tgui
 
             auto& renderer = pair.second;
             const auto& properties = m_themeLoader->load(m_primary, pair.first);
+
+            // Widgets that requested their own renderer keep looking the same, as if the copy had been made earlier
+            renderer->detachCopyOnWriteObservers();
+
             auto observers = std::move(renderer->observers);
 
             renderer = RendererData::create();
@@ -269,10 +269,11 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
 
-        std::stringstream stream;
-        stream.write(reinterpret_cast<char*>(fileContents.get()), static_cast<std::streamsize>(fileSize));
-
-        std::unique_ptr<DataIO::Node> root = DataIO::parse(stream);
+        std::unique_ptr<DataIO::Node> root;
+        if (DataIO::isBinary(fileContents.get(), fileSize))
+            root = DataIO::parseBinary(fileContents.get(), fileSize);
+        else
+            root = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         String resourcePath;
         auto slashPos = filename.find_last_of("/\\");
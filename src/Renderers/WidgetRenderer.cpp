@@ -36,6 +36,7 @@ namespace tgui
     RendererData::RendererData(const RendererData& other) :
         propertyValuePairs{other.propertyValuePairs},
         observers{other.observers},
+        copyOnWriteObservers{other.copyOnWriteObservers},
         connectedTheme{nullptr},
         themePropertiesInherited{false},
         shared{false}
@@ -52,6 +53,7 @@ namespace tgui
 
             std::swap(propertyValuePairs,       temp.propertyValuePairs);
             std::swap(observers,                temp.observers);
+            std::swap(copyOnWriteObservers,     temp.copyOnWriteObservers);
             std::swap(connectedTheme,           temp.connectedTheme);
             std::swap(themePropertiesInherited, temp.themePropertiesInherited);
             std::swap(shared,                   temp.shared);
@@ -91,6 +93,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RendererData::detachCopyOnWriteObservers()
+    {
+        if (copyOnWriteObservers.empty())
+            return;
+
+        // All widgets that were still waiting for their own copy will share a single copy of the unchanged data.
+        // They will each still get a separate copy when they change a property themselves.
+        auto data = std::make_shared<RendererData>(*this);
+        data->observers = copyOnWriteObservers;
+        data->shared = true;
+
+        const auto widgets = std::move(copyOnWriteObservers);
+        copyOnWriteObservers.clear();
+        for (Widget* widget : widgets)
+        {
+            observers.erase(widget);
+
+            WidgetRenderer* renderer = widget->getSharedRenderer();
+            renderer->setData(data);
+            renderer->setCopyOnWrite(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +158,7 @@ namespace tgui
     {
         if (this != &other)
         {
+            setCopyOnWrite(nullptr);
             m_data = other.m_data;
 
             // We have to mark the data as shared, so that changing the accessing the renderer later will create a copy instead
@@ -181,9 +209,21 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const String& property, ObjectConverter&& value)
     {
-        if (m_data->propertyValuePairs[property] == value)
+        const auto it = m_data->propertyValuePairs.find(property);
+        if ((it != m_data->propertyValuePairs.end()) && (it->second == value))
             return;
 
+        if (m_copyOnWriteObserver)
+        {
+            // The widget asked for its own renderer earlier, but the data was still shared until now
+            Widget* widget = m_copyOnWriteObserver;
+            unsubscribe(widget);
+            m_data = clone();
+            subscribe(widget);
+        }
+        else // Widgets that asked for their own renderer may not be affected by the change to the shared data
+            m_data->detachCopyOnWriteObservers();
+
         const ObjectConverter oldValue = m_data->propertyValuePairs[property];
         m_data->propertyValuePairs[property] = value;
 
@@ -229,12 +269,36 @@ namespace tgui
     void WidgetRenderer::unsubscribe(Widget* widget)
     {
         m_data->observers.erase(widget);
+        m_data->copyOnWriteObservers.erase(widget);
+
+        if (m_copyOnWriteObserver == widget)
+            m_copyOnWriteObserver = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setCopyOnWrite(Widget* widget)
+    {
+        if (m_copyOnWriteObserver)
+            m_data->copyOnWriteObservers.erase(m_copyOnWriteObserver);
+
+        m_copyOnWriteObserver = widget;
+        if (widget)
+            m_data->copyOnWriteObservers.insert(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool WidgetRenderer::isCopyOnWrite() const
+    {
+        return (m_copyOnWriteObserver != nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setData(const std::shared_ptr<RendererData>& data)
     {
+        setCopyOnWrite(nullptr);
         m_data = data;
     }
 
@@ -251,6 +315,7 @@ namespace tgui
     {
         auto data = std::make_shared<RendererData>(*m_data);
         data->observers = {};
+        data->copyOnWriteObservers = {};
         data->connectedTheme = nullptr;
         data->shared = false;
         return data;
@@ -30,6 +30,7 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <set>
 #endif
 
@@ -37,10 +38,68 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Parameters of the signal that is currently being emitted. Each emission stores its parameters on its own stack
+        // and restores the previous value when it ends, so nested emissions and emissions on other threads don't interfere.
+        thread_local const void* const* currentParameters = nullptr;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Signal::m_lastSignalId = 0;
-    std::deque<const void*> Signal::m_parameters;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::~Signal()
+    {
+        if (!m_emitState)
+            return;
+
+        // A handler is destroying the signal while it is being emitted. The handler that is currently executing is part of
+        // m_handlers, so the vector is moved to the outermost emission (which keeps the function objects at the same address)
+        // and the emissions are told to stop once the handler returns.
+        EmitState* state = m_emitState;
+        while (state->previous)
+        {
+            state->signalDestroyed = true;
+            state = state->previous;
+        }
+
+        state->signalDestroyed = true;
+        state->handlersKeptAlive = std::move(m_handlers);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::Signal(Signal&& other) noexcept :
+        m_enabled                       {other.m_enabled},
+        m_name                          {std::move(other.m_name)},
+        m_handlers                      {std::move(other.m_handlers)},
+        m_handlersConnectedDuringEmit   {std::move(other.m_handlersConnectedDuringEmit)},
+        m_emitState                     {nullptr},
+        m_handlersDisconnectedDuringEmit{other.m_handlersDisconnectedDuringEmit}
+    {
+        assert(!other.m_emitState); // Moving a signal while it is being emitted isn't supported
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& Signal::operator=(Signal&& other) noexcept
+    {
+        if (this != &other)
+        {
+            assert(!m_emitState && !other.m_emitState); // Moving a signal while it is being emitted isn't supported
+
+            m_enabled = other.m_enabled;
+            m_name = std::move(other.m_name);
+            m_handlers = std::move(other.m_handlers);
+            m_handlersConnectedDuringEmit = std::move(other.m_handlersConnectedDuringEmit);
+            m_handlersDisconnectedDuringEmit = other.m_handlersDisconnectedDuringEmit;
+        }
+
+        return *this;
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,7 +118,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            disconnectAll(); // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -69,35 +128,158 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (id == 0)
+            return false;
+
+        const auto it = std::find_if(m_handlers.begin(), m_handlers.end(), [id](const Handler& handler){ return handler.id == id; });
+        if (it != m_handlers.end())
+        {
+            if (m_emitState)
+            {
+                // Erasing the handler would destroy or move the handler that is being executed, so it is only marked for now
+                it->id = 0;
+                m_handlersDisconnectedDuringEmit = true;
+            }
+            else
+                m_handlers.erase(it);
+
+            return true;
+        }
+
+        const auto pendingIt = std::find_if(m_handlersConnectedDuringEmit.begin(), m_handlersConnectedDuringEmit.end(),
+                                            [id](const Handler& handler){ return handler.id == id; });
+        if (pendingIt != m_handlersConnectedDuringEmit.end())
+        {
+            m_handlersConnectedDuringEmit.erase(pendingIt);
+            return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        m_handlersConnectedDuringEmit.clear();
+
+        if (m_emitState)
+        {
+            for (auto& handler : m_handlers)
+            {
+                if (handler.id != 0)
+                {
+                    handler.id = 0;
+                    m_handlersDisconnectedDuringEmit = true;
+                }
+            }
+        }
+        else
+            m_handlers.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
+    {
+        const void* parameters[] = {static_cast<const void*>(&widget)};
+        return emitImpl(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::addHandler(std::function<void()> handler)
+    {
+        const auto id = ++m_lastSignalId;
+
+        // The handlers can't be reallocated while one of them is executing, so new handlers are added after the emission
+        if (m_emitState)
+            m_handlersConnectedDuringEmit.push_back({id, std::move(handler)});
+        else
+            m_handlers.push_back({id, std::move(handler)});
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::emitImpl(const void* const* parameters)
     {
         if (m_handlers.empty() || !m_enabled)
             return false;
 
-        m_parameters[0] = static_cast<const void*>(&widget);
+        const void* const* const previousParameters = currentParameters;
+        currentParameters = parameters;
+
+        EmitState state;
+        state.previous = m_emitState;
+        m_emitState = &state;
 
-        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
-        for (const auto& handler : handlers)
-            handler.second();
+        // Handlers are called in place. Handlers connected during the emission are stored elsewhere, so the size can't grow
+        // and the function objects don't move while they are executing. Disconnected handlers get an id of 0.
+        const std::size_t handlerCount = m_handlers.size();
+        try
+        {
+            for (std::size_t i = 0; (i < handlerCount) && (i < m_handlers.size()); ++i)
+            {
+                if (m_handlers[i].id == 0)
+                    continue;
+
+                m_handlers[i].func();
+
+                // The handler may have destroyed the widget, in which case we can no longer access any members
+                if (state.signalDestroyed)
+                {
+                    currentParameters = previousParameters;
+                    return true;
+                }
+            }
+        }
+        catch (...)
+        {
+            currentParameters = previousParameters;
+            if (!state.signalDestroyed)
+                finishEmit(state);
+            throw;
+        }
 
+        currentParameters = previousParameters;
+        finishEmit(state);
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Signal::finishEmit(EmitState& state)
+    {
+        m_emitState = state.previous;
+        if (m_emitState)
+            return;
+
+        // Now that the outermost emission has ended, the changes to the handlers can be applied
+        if (m_handlersDisconnectedDuringEmit)
+        {
+            m_handlers.erase(std::remove_if(m_handlers.begin(), m_handlers.end(), [](const Handler& handler){ return handler.id == 0; }), m_handlers.end());
+            m_handlersDisconnectedDuringEmit = false;
+        }
+
+        if (!m_handlersConnectedDuringEmit.empty())
+        {
+            m_handlers.insert(m_handlers.end(), std::make_move_iterator(m_handlersConnectedDuringEmit.begin()), std::make_move_iterator(m_handlersConnectedDuringEmit.end()));
+            m_handlersConnectedDuringEmit.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const void* Signal::getParameter(std::size_t paramIndex)
+    {
+        assert(currentParameters);
+        return currentParameters[paramIndex];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Signal::getWidget()
     {
         return dereferenceParam<Widget*>(0)->shared_from_this();
@@ -110,8 +292,9 @@ namespace tgui
         if (m_handlers.empty())
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&childWindow);
-        return Signal::emit(childWindow);
+        const Widget* widget = childWindow;
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&childWindow)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,10 +311,9 @@ namespace tgui
         if (m_handlers.empty())
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&index);
-        m_parameters[2] = static_cast<const void*>(&item);
-        m_parameters[3] = static_cast<const void*>(&id);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&index),
+                                    static_cast<const void*>(&item), static_cast<const void*>(&id)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,10 +323,9 @@ namespace tgui
         if (m_handlers.empty())
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&index);
-        m_parameters[2] = static_cast<const void*>(&panel);
-        m_parameters[3] = static_cast<const void*>(&id);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&index),
+                                    static_cast<const void*>(&panel), static_cast<const void*>(&id)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,10 +344,9 @@ namespace tgui
 
         assert(!paths.empty());
         const String& pathStr = paths[0].asString();
-        m_parameters[1] = static_cast<const void*>(&pathStr);
-        m_parameters[2] = static_cast<const void*>(&paths[0]);
-        m_parameters[3] = static_cast<const void*>(&paths);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&pathStr),
+                                    static_cast<const void*>(&paths[0]), static_cast<const void*>(&paths)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,9 +356,8 @@ namespace tgui
         if (m_handlers.empty())
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&type);
-        m_parameters[2] = static_cast<const void*>(&visible);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&type), static_cast<const void*>(&visible)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,8 +367,8 @@ namespace tgui
         if (m_handlers.empty())
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&type);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&type)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,9 +378,8 @@ namespace tgui
         if (m_handlers.empty())
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&item);
-        m_parameters[2] = static_cast<const void*>(&fullItem);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&item), static_cast<const void*>(&fullItem)};
+        return emitImpl(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -237,6 +237,9 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         if (!pixelPtr)
             throw Exception{U"Failed to load texture from provided memory location (" + String(fileDataSize) + U" bytes)"};
 
+        // The texture has no filename, so the pixels are needed when the texture has to be serialized
+        data->backendTexture->setPixelStorage(BackendTexture::PixelStorage::Full);
+
         if (!data->backendTexture->load(imageSize, std::move(pixelPtr), smooth))
             throw Exception{U"Failed to load texture from pixels that were loaded from file in memory"};
 
@@ -254,6 +257,9 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         auto pixelPtr = MakeUniqueForOverwrite<std::uint8_t[]>(size.x * size.y * 4);
         std::memcpy(pixelPtr.get(), pixels, size.x * size.y * 4);
 
+        // The texture has no filename, so the pixels are needed when the texture has to be serialized
+        data->backendTexture->setPixelStorage(BackendTexture::PixelStorage::Full);
+
         if (!data->backendTexture->load(size, std::move(pixelPtr), smooth))
             throw Exception{U"Failed to load texture from provided pixel data"};
 
@@ -380,7 +386,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         const UIntRect& partRect = getPartRect();
         TGUI_ASSERT(pixel.x < partRect.width && pixel.y < partRect.height, "Texture::isTransparentPixel called with pixel outside texture rectangle");
 
-        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
+        const UIntRect& atlasRect = m_data->atlasRect;
+        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left + atlasRect.left, pixel.y + partRect.top + atlasRect.top});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -477,6 +484,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         {
             if (m_data->svgImage)
                 m_partRect = {0, 0, static_cast<unsigned int>(m_data->svgImage->getSize().x), static_cast<unsigned int>(m_data->svgImage->getSize().y)};
+            else if (m_data->atlasRect != UIntRect{})
+                m_partRect = {0, 0, m_data->atlasRect.width, m_data->atlasRect.height};
             else
             {
                 const Vector2u textureSize = m_data->backendTexture->getSize();
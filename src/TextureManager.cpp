@@ -28,11 +28,20 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Exception.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::list<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
+    unsigned int TextureManager::m_atlasPageSize = 1024;
+    unsigned int TextureManager::m_atlasMaxImageSize = 128;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,7 +90,39 @@ namespace tgui
             if (data->svgImage->isSet())
                 return data;
         }
-        else // Not an svg
+        else if (m_atlasEnabled)
+        {
+            // Load the pixels without uploading them, we first need to know the size to decide whether to put it in the atlas
+            BackendTexture loadedImage;
+            loadedImage.setPixelStorage(BackendTexture::PixelStorage::Full);
+            if (texture.getBackendTextureLoader()(loadedImage, filename, smooth))
+            {
+                const Vector2u imageSize = loadedImage.getSize();
+                if (!loadedImage.getPixels())
+                {
+                    // The loader didn't keep the pixels, so we can't copy them and have to let it load the image again
+                    data->backendTexture = getBackend()->createTexture();
+                    if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
+                        return data;
+                }
+                else if ((imageSize.x <= m_atlasMaxImageSize) && (imageSize.y <= m_atlasMaxImageSize)
+                      && addImageToAtlas(*data, imageSize, loadedImage.getPixels(), smooth))
+                {
+                    return data;
+                }
+                else // The image is too large for the atlas, so give it its own texture
+                {
+                    const std::size_t byteCount = static_cast<std::size_t>(imageSize.x) * imageSize.y * 4;
+                    auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(byteCount);
+                    std::memcpy(pixels.get(), loadedImage.getPixels(), byteCount);
+
+                    data->backendTexture = getBackend()->createTexture();
+                    if (data->backendTexture->load(imageSize, std::move(pixels), smooth))
+                        return data;
+                }
+            }
+        }
+        else // Not an svg and not using the atlas
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
@@ -134,6 +175,9 @@ namespace tgui
                     // If this was the only place where the texture is used then delete it
                     if (--(dataIt->users) == 0)
                     {
+                        if (dataIt->data->atlasRect != UIntRect{})
+                            removeImageFromAtlas(*dataIt->data);
+
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
                             m_imageMap.erase(imageIt);
@@ -155,6 +199,222 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isImageCached(const String& filename)
+    {
+        return m_imageMap.find(filename) != m_imageMap.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasPageSize(unsigned int size)
+    {
+        m_atlasPageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPageSize()
+    {
+        return m_atlasPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasMaxImageSize(unsigned int size)
+    {
+        m_atlasMaxImageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasMaxImageSize()
+    {
+        return m_atlasMaxImageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return m_atlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addImageToAtlas(TextureData& data, Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        // A border of 1 pixel is kept around the image, so that the neighbouring images don't bleed into it when filtering
+        const Vector2u paddedSize{size.x + 2, size.y + 2};
+        if ((paddedSize.x > m_atlasPageSize) || (paddedSize.y > m_atlasPageSize))
+            return false;
+
+        AtlasPage* page = nullptr;
+        std::size_t segmentIndex = 0;
+        Vector2u location;
+        for (auto& existingPage : m_atlasPages)
+        {
+            if ((existingPage.smooth == smooth) && findAtlasLocation(existingPage, paddedSize, segmentIndex, location))
+            {
+                page = &existingPage;
+                break;
+            }
+        }
+
+        if (!page)
+        {
+            TGUI_EMPLACE_BACK(newPage, m_atlasPages)
+            newPage.smooth = smooth;
+            newPage.skyline.push_back({0, 0, m_atlasPageSize});
+
+            // Start with a transparent texture, so that unused parts of the page never contain garbage
+            const auto emptyPixels = std::make_unique<std::uint8_t[]>(static_cast<std::size_t>(m_atlasPageSize) * m_atlasPageSize * 4);
+            newPage.texture = getBackend()->createTexture();
+            if (!newPage.texture->loadTextureOnly({m_atlasPageSize, m_atlasPageSize}, emptyPixels.get(), smooth)
+             || !findAtlasLocation(newPage, paddedSize, segmentIndex, location))
+            {
+                m_atlasPages.pop_back();
+                return false;
+            }
+
+            page = &newPage;
+        }
+
+        // Copy the image into the middle of the padded rectangle and repeat the pixels on its edges in the border
+        std::vector<std::uint8_t> paddedPixels(static_cast<std::size_t>(paddedSize.x) * paddedSize.y * 4);
+        for (unsigned int y = 0; y < paddedSize.y; ++y)
+        {
+            const unsigned int srcY = std::min(std::max(y, 1u) - 1, size.y - 1);
+            for (unsigned int x = 0; x < paddedSize.x; ++x)
+            {
+                const unsigned int srcX = std::min(std::max(x, 1u) - 1, size.x - 1);
+                std::memcpy(&paddedPixels[(static_cast<std::size_t>(y) * paddedSize.x + x) * 4],
+                            &pixels[(static_cast<std::size_t>(srcY) * size.x + srcX) * 4], 4);
+            }
+        }
+
+        const UIntRect paddedRect{location.x, location.y, paddedSize.x, paddedSize.y};
+        if (!page->texture->updatePixels(paddedRect, paddedPixels.data()))
+        {
+            if (page->images == 0)
+                m_atlasPages.remove_if([page](const AtlasPage& existingPage){ return &existingPage == page; });
+
+            return false;
+        }
+
+        insertAtlasRect(*page, segmentIndex, paddedRect);
+        ++page->images;
+
+        data.backendTexture = page->texture;
+        data.atlasRect = {location.x + 1, location.y + 1, size.x, size.y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::findAtlasLocation(const AtlasPage& page, Vector2u size, std::size_t& segmentIndex, Vector2u& location)
+    {
+        const Vector2u pageSize = page.texture->getSize();
+
+        bool found = false;
+        for (std::size_t i = 0; i < page.skyline.size(); ++i)
+        {
+            // The segments are sorted from left to right, so if the rectangle doesn't fit here then it won't fit further right either
+            const unsigned int x = page.skyline[i].x;
+            if (x + size.x > pageSize.x)
+                break;
+
+            // The rectangle has to be placed on top of the highest segment below it
+            unsigned int y = 0;
+            unsigned int remainingWidth = size.x;
+            for (std::size_t j = i; (j < page.skyline.size()) && (remainingWidth > 0); ++j)
+            {
+                y = std::max(y, page.skyline[j].y);
+                remainingWidth -= std::min(remainingWidth, page.skyline[j].width);
+            }
+
+            if (y + size.y > pageSize.y)
+                continue;
+
+            if (!found || (y < location.y))
+            {
+                found = true;
+                segmentIndex = i;
+                location = {x, y};
+            }
+        }
+
+        return found;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::insertAtlasRect(AtlasPage& page, std::size_t segmentIndex, const UIntRect& rect)
+    {
+        auto& skyline = page.skyline;
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(segmentIndex), {rect.left, rect.top + rect.height, rect.width});
+
+        // Shrink or remove the segments that are now hidden below the new segment
+        const unsigned int right = rect.left + rect.width;
+        const std::size_t nextIndex = segmentIndex + 1;
+        while ((nextIndex < skyline.size()) && (skyline[nextIndex].x < right))
+        {
+            const unsigned int segmentRight = skyline[nextIndex].x + skyline[nextIndex].width;
+            if (segmentRight <= right)
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(nextIndex));
+            else
+            {
+                skyline[nextIndex].x = right;
+                skyline[nextIndex].width = segmentRight - right;
+                break;
+            }
+        }
+
+        // Merge neighbouring segments that have the same height
+        for (std::size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            }
+            else
+                ++i;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeImageFromAtlas(const TextureData& data)
+    {
+        for (auto it = m_atlasPages.begin(); it != m_atlasPages.end(); ++it)
+        {
+            if (it->texture != data.backendTexture)
+                continue;
+
+            // The space of individual images isn't reused, the page is only released when none of its images are used anymore
+            if (--(it->images) == 0)
+                m_atlasPages.erase(it);
+
+            return;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
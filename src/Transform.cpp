@@ -34,6 +34,14 @@
     #endif
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_TRANSFORM_USE_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define TGUI_TRANSFORM_USE_NEON 1
+    #include <arm_neon.h>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -49,49 +57,47 @@ namespace tgui
 
     Transform::Transform(float a00, float a01, float a02,
               float a10, float a11, float a12,
-              float a20, float a21, float a22)
+              float, float, float) :
+        m_matrix{a00, a10, a01, a11, a02, a12}
     {
-        m_matrix[0] = a00; m_matrix[4] = a01; m_matrix[8]  = 0.f; m_matrix[12] = a02;
-        m_matrix[1] = a10; m_matrix[5] = a11; m_matrix[9]  = 0.f; m_matrix[13] = a12;
-        m_matrix[2] = 0.f; m_matrix[6] = 0.f; m_matrix[10] = 1.f; m_matrix[14] = 0.f;
-        m_matrix[3] = a20; m_matrix[7] = a21; m_matrix[11] = 0.f; m_matrix[15] = a22;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Transform::Transform(const std::array<float, 16>& matrix) :
-        m_matrix(matrix)
+        m_matrix{matrix[0], matrix[1], matrix[4], matrix[5], matrix[12], matrix[13]}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::array<float, 16>& Transform::getMatrix() const
+    std::array<float, 16> Transform::getMatrix() const
     {
-        return m_matrix;
+        return {m_matrix[0], m_matrix[1], 0.f, 0.f,
+                m_matrix[2], m_matrix[3], 0.f, 0.f,
+                0.f,         0.f,         1.f, 0.f,
+                m_matrix[4], m_matrix[5], 0.f, 1.f};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Transform Transform::getInverse() const
     {
-        // Compute the determinant
-        const float det = m_matrix[0] * (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13])
-                        - m_matrix[1] * (m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12])
-                        + m_matrix[3] * (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]);
+        // Compute the determinant of the 2x2 part, the translation doesn't influence whether the matrix is invertible
+        const float det = m_matrix[0] * m_matrix[3] - m_matrix[1] * m_matrix[2];
 
         // Compute the inverse if the determinant is not zero (don't use an epsilon because the determinant may *really* be tiny)
         if (det != 0.f)
         {
-            return { (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13]) / det,
-                    -(m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12]) / det,
-                     (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]) / det,
-                    -(m_matrix[15] * m_matrix[1] - m_matrix[3] * m_matrix[13]) / det,
-                     (m_matrix[15] * m_matrix[0] - m_matrix[3] * m_matrix[12]) / det,
-                    -(m_matrix[13] * m_matrix[0] - m_matrix[1] * m_matrix[12]) / det,
-                     (m_matrix[7]  * m_matrix[1] - m_matrix[3] * m_matrix[5])  / det,
-                    -(m_matrix[7]  * m_matrix[0] - m_matrix[3] * m_matrix[4])  / det,
-                     (m_matrix[5]  * m_matrix[0] - m_matrix[1] * m_matrix[4])  / det};
+            return { m_matrix[3] / det,
+                    -m_matrix[2] / det,
+                     (m_matrix[2] * m_matrix[5] - m_matrix[3] * m_matrix[4]) / det,
+                    -m_matrix[1] / det,
+                     m_matrix[0] / det,
+                     (m_matrix[1] * m_matrix[4] - m_matrix[0] * m_matrix[5]) / det,
+                     0.f,
+                     0.f,
+                     1.f};
         }
         else
             return {};
@@ -101,8 +107,48 @@ namespace tgui
 
     Vector2f Transform::transformPoint(const Vector2f& point) const
     {
-        return {m_matrix[0] * point.x + m_matrix[4] * point.y + m_matrix[12],
-                m_matrix[1] * point.x + m_matrix[5] * point.y + m_matrix[13]};
+        return {m_matrix[0] * point.x + m_matrix[2] * point.y + m_matrix[4],
+                m_matrix[1] * point.x + m_matrix[3] * point.y + m_matrix[5]};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Transform::transformVertexPositions(Vertex* vertices, std::size_t vertexCount) const
+    {
+        std::size_t i = 0;
+
+#if TGUI_TRANSFORM_USE_SSE2
+        // Two vertices are transformed at once, with the x and y of both positions stored in a single register
+        const __m128 column0 = _mm_setr_ps(m_matrix[0], m_matrix[1], m_matrix[0], m_matrix[1]);
+        const __m128 column1 = _mm_setr_ps(m_matrix[2], m_matrix[3], m_matrix[2], m_matrix[3]);
+        const __m128 translation = _mm_setr_ps(m_matrix[4], m_matrix[5], m_matrix[4], m_matrix[5]);
+        for (; i + 1 < vertexCount; i += 2)
+        {
+            __m128 positions = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vertices[i].position));
+            positions = _mm_loadh_pi(positions, reinterpret_cast<const __m64*>(&vertices[i + 1].position));
+
+            const __m128 xValues = _mm_shuffle_ps(positions, positions, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 yValues = _mm_shuffle_ps(positions, positions, _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xValues, column0), _mm_mul_ps(yValues, column1)), translation);
+
+            _mm_storel_pi(reinterpret_cast<__m64*>(&vertices[i].position), result);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(&vertices[i + 1].position), result);
+        }
+#elif TGUI_TRANSFORM_USE_NEON
+        // The matrix is stored column by column, so each column can be loaded directly
+        const float32x2_t column0 = vld1_f32(&m_matrix[0]);
+        const float32x2_t column1 = vld1_f32(&m_matrix[2]);
+        const float32x2_t translation = vld1_f32(&m_matrix[4]);
+        for (; i < vertexCount; ++i)
+        {
+            const float32x2_t position = vld1_f32(&vertices[i].position.x);
+            const float32x2_t result = vadd_f32(vadd_f32(vmul_lane_f32(column0, position, 0), vmul_lane_f32(column1, position, 1)), translation);
+            vst1_f32(&vertices[i].position.x, result);
+        }
+#endif
+
+        for (; i < vertexCount; ++i)
+            vertices[i].position = transformPoint(vertices[i].position);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,18 +177,15 @@ namespace tgui
 
     Transform& Transform::combine(const Transform& other)
     {
-        const auto& a = m_matrix;
+        const std::array<float, 6> a = m_matrix;
         const auto& b = other.m_matrix;
 
-        *this = Transform(a[0] * b[0]  + a[4] * b[1]  + a[12] * b[3],
-                          a[0] * b[4]  + a[4] * b[5]  + a[12] * b[7],
-                          a[0] * b[12] + a[4] * b[13] + a[12] * b[15],
-                          a[1] * b[0]  + a[5] * b[1]  + a[13] * b[3],
-                          a[1] * b[4]  + a[5] * b[5]  + a[13] * b[7],
-                          a[1] * b[12] + a[5] * b[13] + a[13] * b[15],
-                          a[3] * b[0]  + a[7] * b[1]  + a[15] * b[3],
-                          a[3] * b[4]  + a[7] * b[5]  + a[15] * b[7],
-                          a[3] * b[12] + a[7] * b[13] + a[15] * b[15]);
+        m_matrix = {a[0] * b[0] + a[2] * b[1],
+                    a[1] * b[0] + a[3] * b[1],
+                    a[0] * b[2] + a[2] * b[3],
+                    a[1] * b[2] + a[3] * b[3],
+                    a[0] * b[4] + a[2] * b[5] + a[4],
+                    a[1] * b[4] + a[3] * b[5] + a[5]};
         return *this;
     }
 
@@ -150,9 +193,10 @@ namespace tgui
 
     Transform& Transform::translate(const Vector2f& offset)
     {
-        return combine({1, 0, offset.x,
-                        0, 1, offset.y,
-                        0, 0, 1});
+        // Combining with a translation matrix only changes the translation part of the matrix
+        m_matrix[4] += m_matrix[0] * offset.x + m_matrix[2] * offset.y;
+        m_matrix[5] += m_matrix[1] * offset.x + m_matrix[3] * offset.y;
+        return *this;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,8 +250,8 @@ namespace tgui
 
     void Transform::roundPosition(float pixelScaleX, float pixelScaleY)
     {
-        m_matrix[12] = std::round(m_matrix[12] * pixelScaleX) / pixelScaleX;
-        m_matrix[13] = std::round(m_matrix[13] * pixelScaleY) / pixelScaleY;
+        m_matrix[4] = std::round(m_matrix[4] * pixelScaleX) / pixelScaleX;
+        m_matrix[5] = std::round(m_matrix[5] * pixelScaleY) / pixelScaleY;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
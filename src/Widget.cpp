@@ -197,6 +197,8 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         m_renderer->subscribe(this);
+        if (other.m_renderer->isCopyOnWrite())
+            m_renderer->setCopyOnWrite(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,8 +256,11 @@ namespace tgui
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
+        const bool copyOnWrite = other.m_renderer->isCopyOnWrite();
         other.m_renderer->unsubscribe(&other);
         m_renderer->subscribe(this);
+        if (copyOnWrite)
+            m_renderer->setCopyOnWrite(this);
 
         other.m_renderer = nullptr;
 
@@ -294,6 +299,8 @@ namespace tgui
             m_rotationDeg          = other.m_rotationDeg;
             m_prevPosition         = other.m_prevPosition;
             m_prevSize             = other.m_prevSize;
+            m_transformChanged     = true;
+            m_inverseTransformChanged = true;
             m_boundPositionLayouts = {};
             m_boundSizeLayouts     = {};
             m_enabled              = other.m_enabled;
@@ -329,6 +336,8 @@ namespace tgui
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
             m_renderer->subscribe(this);
+            if (other.m_renderer->isCopyOnWrite())
+                m_renderer->setCopyOnWrite(this);
         }
 
         return *this;
@@ -340,6 +349,7 @@ namespace tgui
     {
         if (this != &other)
         {
+            const bool copyOnWrite = other.m_renderer->isCopyOnWrite();
             m_renderer->unsubscribe(this);
             other.m_renderer->unsubscribe(&other);
 
@@ -361,6 +371,8 @@ namespace tgui
             m_rotationDeg          = std::move(other.m_rotationDeg);
             m_prevPosition         = std::move(other.m_prevPosition);
             m_prevSize             = std::move(other.m_prevSize);
+            m_transformChanged     = true;
+            m_inverseTransformChanged = true;
             m_boundPositionLayouts = std::move(other.m_boundPositionLayouts);
             m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
             m_enabled              = std::move(other.m_enabled);
@@ -397,6 +409,8 @@ namespace tgui
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
             m_renderer->subscribe(this);
+            if (copyOnWrite)
+                m_renderer->setCopyOnWrite(this);
 
             if (other.m_parent)
                 SignalManager::getSignalManager()->remove(&other);
@@ -560,12 +574,9 @@ namespace tgui
 
     WidgetRenderer* Widget::getRenderer()
     {
+        // The shared data isn't copied until a property is actually changed, as most widgets only read from the renderer
         if (m_renderer->getData()->shared)
-        {
-            m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this);
-        }
+            m_renderer->setCopyOnWrite(this);
 
         return m_renderer.get();
     }
@@ -578,6 +589,10 @@ namespace tgui
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
 
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
+
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
@@ -598,6 +613,11 @@ namespace tgui
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
+        // The origins are relative to the size, so the transform changes even if only the size changed
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
+
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
@@ -639,16 +659,7 @@ namespace tgui
             if (!scaledOrRotated)
                 pos += offset - origin; // Optimization when there is no scaling or rotation
             else
-            {
-                const Vector2f rotOrigin{getRotationOrigin().x * getSize().x, getRotationOrigin().y * getSize().y};
-                const Vector2f scaleOrigin{getScaleOrigin().x * getSize().x, getScaleOrigin().y * getSize().y};
-
-                Transform transform;
-                transform.translate(-origin);
-                transform.rotate(getRotation(), rotOrigin);
-                transform.scale(getScale(), scaleOrigin);
-                pos += transform.transformPoint(offset);
-            }
+                pos = getTransform().transformPoint(offset);
         }
 
         if (m_parent)
@@ -685,6 +696,9 @@ namespace tgui
     void Widget::setOrigin(Vector2f origin)
     {
         m_origin = origin;
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -693,6 +707,9 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -701,6 +718,9 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -719,6 +739,9 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -727,6 +750,9 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+        m_transformChanged = true;
+        m_inverseTransformChanged = true;
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -741,6 +767,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const Transform& Widget::getTransform() const
+    {
+        if (!m_transformChanged)
+            return m_transform;
+
+        const Vector2f size = getSize();
+        const Vector2f origin{m_origin.x * size.x, m_origin.y * size.y};
+
+        m_transform = Transform{};
+        m_transform.translate(getPosition() - origin);
+        if (m_rotationDeg != 0)
+        {
+            const Vector2f rotOrigin{getRotationOrigin().x * size.x, getRotationOrigin().y * size.y};
+            m_transform.rotate(m_rotationDeg, rotOrigin);
+        }
+        if ((m_scaleFactors.x != 1) || (m_scaleFactors.y != 1))
+        {
+            const Vector2f scaleOrigin{getScaleOrigin().x * size.x, getScaleOrigin().y * size.y};
+            m_transform.scale(m_scaleFactors, scaleOrigin);
+        }
+
+        m_transformChanged = false;
+        return m_transform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Transform& Widget::getInverseTransform() const
+    {
+        if (m_inverseTransformChanged)
+        {
+            m_inverseTransform = getTransform().getInverse();
+            m_inverseTransformChanged = false;
+        }
+
+        return m_inverseTransform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::showWithEffect(ShowEffectType type, Duration duration)
     {
         setVisible(true);
@@ -1003,6 +1069,7 @@ namespace tgui
     void Widget::setVisible(bool visible)
     {
         m_visible = visible;
+        invalidateParentLayer();
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -1025,6 +1092,7 @@ namespace tgui
     void Widget::setEnabled(bool enabled)
     {
         m_enabled = enabled;
+        invalidateParentLayer();
 
         if (!enabled)
         {
@@ -1045,6 +1113,8 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        invalidateParentLayer();
+
         if (focused)
         {
             if (canGainFocus())
@@ -1101,6 +1171,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("Font");
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1116,6 +1187,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1137,6 +1209,7 @@ namespace tgui
             m_textSizeCached = m_textSize;
 
         updateTextSize();
+        invalidateParentLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1907,6 +1980,15 @@ namespace tgui
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
+        invalidateParentLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateParentLayer()
+    {
+        if (m_parent)
+            m_parent->invalidateLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
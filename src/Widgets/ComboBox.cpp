@@ -343,14 +343,12 @@ namespace tgui
 
     bool ComboBox::removeItem(const String& itemName)
     {
-        // Implemented like removeItemByIndex instead of like removeItemById because m_listBox->getItems() may be slow
-
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
 
         // Shrink the list size
-        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getFilteredItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
         return ret;
@@ -360,12 +358,9 @@ namespace tgui
 
     bool ComboBox::removeItemById(const String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const int index = m_listBox->getIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -379,7 +374,7 @@ namespace tgui
         m_text.setString(m_listBox->getSelectedItem());
 
         // Shrink the list size
-        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getFilteredItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
         return ret;
@@ -429,6 +424,11 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        // The changed item may no longer match the filter, or match it now
+        if (!m_listBox->getFilter().empty())
+            updateListBoxHeight();
+
         return ret;
     }
 
@@ -438,6 +438,11 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        // The changed item may no longer match the filter, or match it now
+        if (!m_listBox->getFilter().empty())
+            updateListBoxHeight();
+
         return ret;
     }
 
@@ -447,6 +452,11 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        // The changed item may no longer match the filter, or match it now
+        if (!m_listBox->getFilter().empty())
+            updateListBoxHeight();
+
         return ret;
     }
 
@@ -519,16 +529,29 @@ namespace tgui
 
     bool ComboBox::contains(const String& item) const
     {
-        const auto& items = getItems();
-        return std::find(items.begin(), items.end(), item) != items.end();
+        return m_listBox->contains(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::containsId(const String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setFilter(const String& filter)
+    {
+        m_listBox->setFilter(filter);
+        updateListBoxHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& ComboBox::getFilter() const
+    {
+        return m_listBox->getFilter();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -899,10 +922,10 @@ namespace tgui
         const Padding padding = m_listBox->getSharedRenderer()->getPadding();
 
         if (m_nrOfItemsToDisplay > 0)
-            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * (std::min<std::size_t>(m_nrOfItemsToDisplay, std::max<std::size_t>(m_listBox->getItemCount(), 1))))
+            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * (std::min<std::size_t>(m_nrOfItemsToDisplay, std::max<std::size_t>(m_listBox->getFilteredItemCount(), 1))))
                                              + borders.getTop() + borders.getBottom() + padding.getTop() + padding.getBottom()});
         else
-            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1))
+            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getFilteredItemCount(), 1))
                                              + borders.getTop() + borders.getBottom() + padding.getTop() + padding.getBottom()});
 
     }
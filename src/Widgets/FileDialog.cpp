@@ -34,6 +34,10 @@
     #include <vector>
     #include <map>
     #include <ctime>
+    #include <mutex>
+    #include <atomic>
+    #include <thread>
+    #include <iterator>
 #endif
 
 #ifdef TGUI_SYSTEM_WINDOWS
@@ -48,6 +52,9 @@ namespace tgui
     constexpr const char FileDialog::StaticWidgetType[];
 #endif
 
+    // Amount of entries that the worker thread lists before handing them over to the gui thread
+    static constexpr std::size_t DirectoryListingChunkSize = 500;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     FileDialog::FileDialog(const char* typeName, bool initRenderer) :
@@ -150,8 +157,8 @@ namespace tgui
         onFileSelect            {other.onFileSelect},
         onCancel                {other.onCancel},
         m_currentDirectory      {other.m_currentDirectory},
-        m_filesInDirectory      {other.m_filesInDirectory},
-        m_fileIcons             {other.m_fileIcons},
+        m_listingGeneration     {other.m_listingGeneration},
+        m_iconsGeneration       {other.m_iconsGeneration},
         m_sortColumnIndex       {other.m_sortColumnIndex},
         m_sortInversed          {other.m_sortInversed},
         m_pathHistory           {other.m_pathHistory},
@@ -191,6 +198,8 @@ namespace tgui
         m_currentDirectory      {std::move(other.m_currentDirectory)},
         m_filesInDirectory      {std::move(other.m_filesInDirectory)},
         m_fileIcons             {std::move(other.m_fileIcons)},
+        m_listingGeneration     {std::move(other.m_listingGeneration)},
+        m_iconsGeneration       {std::move(other.m_iconsGeneration)},
         m_sortColumnIndex       {std::move(other.m_sortColumnIndex)},
         m_sortInversed          {std::move(other.m_sortInversed)},
         m_pathHistory           {std::move(other.m_pathHistory)},
@@ -201,7 +210,9 @@ namespace tgui
         m_fileTypeFilters       {std::move(other.m_fileTypeFilters)},
         m_selectedFileTypeFilter{std::move(other.m_selectedFileTypeFilter)},
         m_iconLoader            {std::move(other.m_iconLoader)},
-        m_selectedFiles         {std::move(other.m_selectedFiles)}
+        m_selectedFiles         {std::move(other.m_selectedFiles)},
+        m_directoryListWorker   {std::move(other.m_directoryListWorker)},
+        m_listingDirectory      {std::move(other.m_listingDirectory)}
     {
         connectSignals();
     }
@@ -217,8 +228,8 @@ namespace tgui
             onFileSelect = other.onFileSelect;
             onCancel = other.onCancel;
             m_currentDirectory = other.m_currentDirectory;
-            m_filesInDirectory = other.m_filesInDirectory;
-            m_fileIcons = other.m_fileIcons;
+            m_listingGeneration = other.m_listingGeneration;
+            m_iconsGeneration = other.m_iconsGeneration;
             m_sortColumnIndex = other.m_sortColumnIndex;
             m_sortInversed = other.m_sortInversed;
             m_pathHistory = other.m_pathHistory;
@@ -234,7 +245,7 @@ namespace tgui
             identifyChildWidgets();
             connectSignals();
 
-            // Update the file list (to refresh icons)
+            // List the directory again instead of copying the files, as the other dialog may still be listing them
             changePath(m_currentDirectory, false);
         }
 
@@ -263,6 +274,8 @@ namespace tgui
             m_currentDirectory = std::move(other.m_currentDirectory);
             m_filesInDirectory = std::move(other.m_filesInDirectory);
             m_fileIcons = std::move(other.m_fileIcons);
+            m_listingGeneration = std::move(other.m_listingGeneration);
+            m_iconsGeneration = std::move(other.m_iconsGeneration);
             m_sortColumnIndex = std::move(other.m_sortColumnIndex);
             m_sortInversed = std::move(other.m_sortInversed);
             m_pathHistory = std::move(other.m_pathHistory);
@@ -274,6 +287,8 @@ namespace tgui
             m_selectedFileTypeFilter = std::move(other.m_selectedFileTypeFilter);
             m_iconLoader = std::move(other.m_iconLoader);
             m_selectedFiles = std::move(other.m_selectedFiles);
+            m_directoryListWorker = std::move(other.m_directoryListWorker);
+            m_listingDirectory = std::move(other.m_listingDirectory);
             ChildWindow::operator=(std::move(other));
 
             connectSignals();
@@ -284,6 +299,10 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FileDialog::~FileDialog() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     FileDialog::Ptr FileDialog::create(const String& title, const String& confirmButtonText, bool allowCreateFolder)
     {
         auto fileDialog = std::make_shared<FileDialog>();
@@ -665,12 +684,21 @@ namespace tgui
 
     bool FileDialog::updateTime(Duration elapsedTime)
     {
-        const bool childWidgetUpdated = ChildWindow::updateTime(elapsedTime);
+        bool screenRefreshRequired = ChildWindow::updateTime(elapsedTime);
+
+        if (m_listingDirectory && addListedFiles())
+            screenRefreshRequired = true;
 
         if (!m_iconLoader->update())
-            return childWidgetUpdated;
+            return screenRefreshRequired;
 
-        m_fileIcons = m_iconLoader->retrieveFileIcons();
+        // Icons that were requested before the current directory was listed belong to an older directory.
+        // The icons for the current directory are only requested once all files are known.
+        std::vector<Texture> fileIcons = m_iconLoader->retrieveFileIcons();
+        if (m_listingDirectory || (!fileIcons.empty() && (m_iconsGeneration != m_listingGeneration)))
+            return screenRefreshRequired;
+
+        m_fileIcons = std::move(fileIcons);
 
         const int oldSelectedItem = m_listView->getSelectedItemIndex();
         sortFilesInListView();
@@ -697,7 +725,10 @@ namespace tgui
         m_currentDirectory = path;
         m_editBoxPath->setText(m_currentDirectory.asString());
 
-        m_filesInDirectory = Filesystem::listFilesInDirectory(path);
+        cancelDirectoryListing();
+        m_filesInDirectory.clear();
+        m_fileIcons.clear();
+        ++m_listingGeneration;
 
 #ifdef TGUI_SYSTEM_WINDOWS
         if (path.asString().empty())
@@ -716,31 +747,96 @@ namespace tgui
                     drive += std::wcslen(drive) + 1;
                 }
             }
-            m_filesInDirectory.clear();
             return;
         }
 #endif // TGUI_SYSTEM_WINDOWS
 
+        // Reading the directory can take a long time (e.g. for huge directories or on network drives), so it is done on a
+        // worker thread. The files are added to the list view in updateTime as they arrive, and are sorted once all are known.
+        if (!m_directoryListWorker)
+            m_directoryListWorker = std::make_unique<DirectoryListWorker>();
+
+        m_directoryListWorker->list(path);
+        m_listingDirectory = true;
+
+        m_listView->setVerticalScrollbarValue(0);
+        sortFilesInListView();
+        updateConfirmButtonEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::cancelDirectoryListing()
+    {
+        if (!m_listingDirectory)
+            return;
+
+        m_directoryListWorker->cancel();
+        m_listingDirectory = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::addListedFiles()
+    {
+        std::vector<Filesystem::FileInfo> files;
+        const bool finished = m_directoryListWorker->retrieveFiles(files);
+
         // If only directories should be shown then remove the files from the list
         if (m_selectingDirectory)
         {
-            m_filesInDirectory.erase(std::remove_if(m_filesInDirectory.begin(), m_filesInDirectory.end(),
-                [](const Filesystem::FileInfo& info){ return !info.directory; }), m_filesInDirectory.end());
+            files.erase(std::remove_if(files.begin(), files.end(),
+                [](const Filesystem::FileInfo& info){ return !info.directory; }), files.end());
         }
 
-        m_fileIcons.clear();
-        if (m_iconLoader->hasGenericIcons())
+        if (!files.empty())
         {
-            m_fileIcons.reserve(m_filesInDirectory.size());
-            for (const auto& file : m_filesInDirectory)
-                m_fileIcons.push_back(m_iconLoader->getGenericFileIcon(file));
+            const std::size_t firstNewFile = m_filesInDirectory.size();
+            m_filesInDirectory.insert(m_filesInDirectory.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+
+            // Generic icons can become available in the middle of the listing, so also add them for files that were added earlier
+            if (m_iconLoader->hasGenericIcons())
+            {
+                m_fileIcons.reserve(m_filesInDirectory.size());
+                for (std::size_t i = m_fileIcons.size(); i < m_filesInDirectory.size(); ++i)
+                    m_fileIcons.push_back(m_iconLoader->getGenericFileIcon(m_filesInDirectory[i]));
+            }
+
+            // The new files are added unsorted at the bottom for now, they are sorted when the listing is finished
+            if (!finished)
+            {
+                m_listView->beginUpdate();
+                for (std::size_t i = firstNewFile; i < m_filesInDirectory.size(); ++i)
+                    addFileToListView(m_filesInDirectory[i], (i < m_fileIcons.size()) ? m_fileIcons[i] : Texture{});
+                m_listView->endUpdate();
+            }
         }
 
+        if (!finished)
+            return !files.empty();
+
+        m_listingDirectory = false;
         m_iconLoader->requestFileIcons(m_filesInDirectory);
+        m_iconsGeneration = m_listingGeneration;
 
-        m_listView->setVerticalScrollbarValue(0);
+        // Sorting changes the order of the items, so the selection can't be restored by index
+        const int oldSelectedItem = m_listView->getSelectedItemIndex();
+        const String selectedFilename = (oldSelectedItem >= 0) ? m_listView->getItem(static_cast<std::size_t>(oldSelectedItem)) : U"";
         sortFilesInListView();
+        if (!selectedFilename.empty())
+        {
+            for (std::size_t i = 0; i < m_listView->getItemCount(); ++i)
+            {
+                if (m_listView->getItem(i) == selectedFilename)
+                {
+                    m_listView->setSelectedItem(i);
+                    break;
+                }
+            }
+        }
+
         updateConfirmButtonEnabled();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -814,99 +910,103 @@ namespace tgui
             m_listView->setHeaderVisible(true);
             m_listView->setShowVerticalGridLines(true);
         }
+        m_listView->beginUpdate();
         m_listView->removeAllItems();
         for (const auto& item : items)
+            addFileToListView(item.first, item.second);
+        m_listView->endUpdate();
+
+        m_listView->setVerticalScrollbarValue(oldScrollbarValue);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::addFileToListView(const Filesystem::FileInfo& file, const Texture& icon)
+    {
+        // Filter the files
+        if (!file.directory && !m_fileTypeFilters[m_selectedFileTypeFilter].second.empty())
         {
-            const Filesystem::FileInfo& file = item.first;
-            const Texture& icon = item.second;
+            const String& lowercaseFilename = file.filename.toLower();
 
-            // Filter the files
-            if (!file.directory && !m_fileTypeFilters[m_selectedFileTypeFilter].second.empty())
+            bool fileAccepted = false;
+            for (const auto& filter : m_fileTypeFilters[m_selectedFileTypeFilter].second)
             {
-                const String& lowercaseFilename = file.filename.toLower();
+                TGUI_ASSERT(!filter.empty(), "FileDialog::addFileToListView can't have empty filter, they are removed in setFileTypeFilters");
 
-                bool fileAccepted = false;
-                for (const auto& filter : m_fileTypeFilters[m_selectedFileTypeFilter].second)
+                if (filter[0] == '*')
                 {
-                    TGUI_ASSERT(!filter.empty(), "FileDialog::sortFilesInListView can't have empty filter, they are removed in setFileTypeFilters");
-
-                    if (filter[0] == '*')
-                    {
-                        if ((lowercaseFilename.length() >= filter.length() - 1)
-                         && (lowercaseFilename.compare(lowercaseFilename.length() - (filter.length() - 1),
-                                                       filter.length() - 1, filter, 1, filter.length() - 1) == 0))
-                        {
-                            fileAccepted = true;
-                            break;
-                        }
-                    }
-                    // Check if the filter matches exactly with the filename
-                    else if (lowercaseFilename == filter)
+                    if ((lowercaseFilename.length() >= filter.length() - 1)
+                     && (lowercaseFilename.compare(lowercaseFilename.length() - (filter.length() - 1),
+                                                   filter.length() - 1, filter, 1, filter.length() - 1) == 0))
                     {
                         fileAccepted = true;
                         break;
                     }
                 }
-
-                if (!fileAccepted)
-                    continue;
+                // Check if the filter matches exactly with the filename
+                else if (lowercaseFilename == filter)
+                {
+                    fileAccepted = true;
+                    break;
+                }
             }
 
-            String fileSizeStr;
-            if (!file.directory)
-            {
-                if (file.fileSize == 0)
-                    fileSizeStr = U"0.0 KB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(100))
-                    fileSizeStr = U"0.1 KB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f, 1) + U" KB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f, 1) + U" MB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f, 1) + U" GB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f / 1000.f, 1) + U" TB";
-            }
+            if (!fileAccepted)
+                return;
+        }
+
+        String fileSizeStr;
+        if (!file.directory)
+        {
+            if (file.fileSize == 0)
+                fileSizeStr = U"0.0 KB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(100))
+                fileSizeStr = U"0.1 KB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f, 1) + U" KB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f, 1) + U" MB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f, 1) + U" GB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f / 1000.f, 1) + U" TB";
+        }
 
-            String modificationTimeStr;
-            bool modificationTimeConverted = false;
-            char buffer[19];
+        String modificationTimeStr;
+        bool modificationTimeConverted = false;
+        char buffer[19];
 #if defined(TGUI_SYSTEM_WINDOWS) && defined(_MSC_VER)
-            std::tm TimeStructure;
-            if (localtime_s(&TimeStructure, &file.modificationTime) == 0)
-            {
-                if (std::strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", &TimeStructure) != 0)
-                    modificationTimeConverted = true;
-            }
-#elif defined(TGUI_SYSTEM_WINDOWS) && defined(__GNUC__) // MinGW doesn't support %e (day of the month without leading 0) and %R (same as %H:%M)
-            if (strftime(&buffer[0], sizeof(buffer), "%d %b %Y  %H:%M", std::localtime(&file.modificationTime)) != 0)
+        std::tm TimeStructure;
+        if (localtime_s(&TimeStructure, &file.modificationTime) == 0)
+        {
+            if (std::strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", &TimeStructure) != 0)
                 modificationTimeConverted = true;
+        }
+#elif defined(TGUI_SYSTEM_WINDOWS) && defined(__GNUC__) // MinGW doesn't support %e (day of the month without leading 0) and %R (same as %H:%M)
+        if (strftime(&buffer[0], sizeof(buffer), "%d %b %Y  %H:%M", std::localtime(&file.modificationTime)) != 0)
+            modificationTimeConverted = true;
 #else
-            if (strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", std::localtime(&file.modificationTime)) != 0)
-                modificationTimeConverted = true;
+        if (strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", std::localtime(&file.modificationTime)) != 0)
+            modificationTimeConverted = true;
 #endif
-            if (modificationTimeConverted)
-                modificationTimeStr = static_cast<char*>(buffer);
+        if (modificationTimeConverted)
+            modificationTimeStr = static_cast<char*>(buffer);
 
 #if defined(TGUI_SYSTEM_WINDOWS)
-            // Hide .lnk and .url extensions
-            String filename = file.filename;
-            const auto filenameLen = file.filename.length();
-            if ((filename.length() > 4) && ((filename.compare(filenameLen - 4, 4, U".lnk", 4) == 0) || (filename.compare(filenameLen - 4, 4, U".url", 4) == 0)))
-                filename.erase(filenameLen - 4, 4);
+        // Hide .lnk and .url extensions
+        String filename = file.filename;
+        const auto filenameLen = file.filename.length();
+        if ((filename.length() > 4) && ((filename.compare(filenameLen - 4, 4, U".lnk", 4) == 0) || (filename.compare(filenameLen - 4, 4, U".url", 4) == 0)))
+            filename.erase(filenameLen - 4, 4);
 
-            const std::size_t itemIndex = m_listView->addItem({filename, fileSizeStr, modificationTimeStr});
+        const std::size_t itemIndex = m_listView->addItem({filename, fileSizeStr, modificationTimeStr});
 #else
-            const std::size_t itemIndex = m_listView->addItem({file.filename, fileSizeStr, modificationTimeStr});
+        const std::size_t itemIndex = m_listView->addItem({file.filename, fileSizeStr, modificationTimeStr});
 #endif
-            m_listView->setItemData(itemIndex, file.directory);
+        m_listView->setItemData(itemIndex, file.directory);
 
-            if (icon.getData())
-                m_listView->setItemIcon(itemIndex, icon);
-        }
-
-        m_listView->setVerticalScrollbarValue(oldScrollbarValue);
+        if (icon.getData())
+            m_listView->setItemIcon(itemIndex, icon);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1446,6 +1546,116 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FileDialog::DirectoryListWorker::DirectoryListWorker() :
+        m_thread{&DirectoryListWorker::run, this}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FileDialog::DirectoryListWorker::~DirectoryListWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+            m_cancelled = true;
+        }
+
+        m_condition.notify_all();
+        m_thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::DirectoryListWorker::list(const Filesystem::Path& path)
+    {
+        cancel();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_path = path;
+            m_jobAvailable = true;
+        }
+
+        m_condition.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::DirectoryListWorker::cancel()
+    {
+        // The worker checks the flag after every entry, so it doesn't take long before it stops reading the directory
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cancelled = true;
+        m_jobAvailable = false;
+        m_condition.wait(lock, [this]{ return !m_busy; });
+
+        m_cancelled = false;
+        m_files.clear();
+        m_finished = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::DirectoryListWorker::retrieveFiles(std::vector<Filesystem::FileInfo>& files)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        files.swap(m_files);
+        return m_finished;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::DirectoryListWorker::run()
+    {
+        while (true)
+        {
+            Filesystem::Path path;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]{ return m_stopping || m_jobAvailable; });
+                if (m_stopping)
+                    return;
+
+                path = m_path;
+                m_jobAvailable = false;
+                m_busy = true;
+            }
+
+            // The entries are requested one at a time so that a cancellation is noticed quickly, but they are only
+            // handed over to the gui thread in chunks to limit how often the mutex is locked.
+            std::vector<Filesystem::FileInfo> chunk;
+            Filesystem::listFilesInDirectory(path, 1, [this,&chunk](std::vector<Filesystem::FileInfo>&& files){
+                if (m_cancelled)
+                    return false;
+
+                chunk.insert(chunk.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+                if (chunk.size() < DirectoryListingChunkSize)
+                    return true;
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_files.insert(m_files.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+                chunk.clear();
+                return true;
+            });
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_cancelled)
+                {
+                    m_files.insert(m_files.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+                    m_finished = true;
+                }
+
+                m_busy = false;
+            }
+
+            m_condition.notify_all();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,9 @@
 #include <TGUI/Widgets/ListBox.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <iterator>
+    #include <numeric>
     #include <cmath>
 #endif
 
@@ -33,6 +36,19 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Combines the 3 characters starting at the given position into a single number (each character needs 21 bits)
+        std::uint64_t getTrigramKey(const String& str, std::size_t pos)
+        {
+            return (static_cast<std::uint64_t>(str[pos]) << 42)
+                 | (static_cast<std::uint64_t>(str[pos + 1]) << 21)
+                 | static_cast<std::uint64_t>(str[pos + 2]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if TGUI_COMPILED_WITH_CPP_VER < 17
     constexpr const char ListBox::StaticWidgetType[];
 #endif
@@ -117,7 +133,22 @@ namespace tgui
         if ((m_maxItems > 0) && (m_items.size() >= m_maxItems))
             return m_maxItems;
 
-        m_scroll->setMaximum(static_cast<unsigned int>((m_items.size() + 1) * m_itemHeight));
+        // Add the new item to the list. The Text object to display it is only created once the item becomes visible.
+        m_items.emplace_back();
+        m_items.back().text = itemName;
+        m_items.back().id = id;
+        addItemToIndices(m_items.size() - 1);
+
+        // The item isn't displayed if it doesn't match the filter
+        if (!m_lowerCaseFilter.empty())
+        {
+            if (!itemMatchesFilter(m_items.size() - 1))
+                return m_items.size() - 1;
+
+            m_filteredItems.push_back(m_items.size() - 1);
+        }
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
 
         // Scroll down when auto-scrolling is enabled
         if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
@@ -126,20 +157,6 @@ namespace tgui
             triggerOnScroll();
         }
 
-        // Create the new item
-        Text newItem;
-        newItem.setFont(m_fontCached);
-        newItem.setColor(m_textColorCached);
-        newItem.setOpacity(m_opacityCached);
-        newItem.setStyle(m_textStyleCached);
-        newItem.setCharacterSize(m_textSizeCached);
-        newItem.setString(itemName);
-        newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-        // Add the new item to the list
-        m_items.emplace_back();
-        m_items.back().text = std::move(newItem);
-        m_items.back().id = id;
         return m_items.size() - 1;
     }
 
@@ -147,11 +164,9 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].text.getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        const auto it = m_itemIndices.find(itemName);
+        if (it != m_itemIndices.end())
+            return setSelectedItemByIndex(it->second);
 
         // No match was found
         deselectItem();
@@ -162,11 +177,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const String& id)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return setSelectedItemByIndex(i);
-        }
+        const auto it = m_idIndices.find(id);
+        if (it != m_idIndices.end())
+            return setSelectedItemByIndex(it->second);
 
         // No match was found
         deselectItem();
@@ -185,15 +198,19 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (index * getItemHeight() < m_scroll->getValue())
+        // Move the scrollbar, unless the item is filtered out
+        const int row = getRowFromItemIndex(static_cast<int>(index));
+        if (row < 0)
+            return true;
+
+        if (static_cast<unsigned int>(row) * getItemHeight() < m_scroll->getValue())
         {
-            m_scroll->setValue(static_cast<unsigned int>(index) * getItemHeight());
+            m_scroll->setValue(static_cast<unsigned int>(row) * getItemHeight());
             triggerOnScroll();
         }
-        else if ((index + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
+        else if ((static_cast<unsigned int>(row) + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
         {
-            m_scroll->setValue((static_cast<unsigned int>(index) + 1) * getItemHeight() - m_scroll->getViewportSize());
+            m_scroll->setValue((static_cast<unsigned int>(row) + 1) * getItemHeight() - m_scroll->getViewportSize());
             triggerOnScroll();
         }
 
@@ -211,11 +228,9 @@ namespace tgui
 
     bool ListBox::removeItem(const String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].text.getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        const auto it = m_itemIndices.find(itemName);
+        if (it != m_itemIndices.end())
+            return removeItemByIndex(it->second);
 
         return false;
     }
@@ -224,11 +239,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const String& id)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return removeItemByIndex(i);
-        }
+        const auto it = m_idIndices.find(id);
+        if (it != m_idIndices.end())
+            return removeItemByIndex(it->second);
 
         return false;
     }
@@ -253,9 +266,10 @@ namespace tgui
         }
 
         // Remove the item
+        removeItemFromIndices(index);
         m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(index));
 
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
         updateItemPositions();
         triggerOnScroll();
 
@@ -272,6 +286,11 @@ namespace tgui
 
         // Clear the list, remove all items
         m_items.clear();
+        m_itemIndices.clear();
+        m_idIndices.clear();
+        m_visibleTexts.clear();
+        m_filteredItems.clear();
+        invalidateFilterIndex();
 
         m_scroll->setMaximum(0);
         triggerOnScroll();
@@ -281,11 +300,9 @@ namespace tgui
 
     String ListBox::getItemById(const String& id) const
     {
-        for (const auto& item : m_items)
-        {
-            if (item.id == id)
-                return item.text.getString();
-        }
+        const auto it = m_idIndices.find(id);
+        if (it != m_idIndices.end())
+            return m_items[it->second].text;
 
         return "";
     }
@@ -297,18 +314,16 @@ namespace tgui
         if (index >= m_items.size())
             return "";
 
-        return m_items[index].text.getString();
+        return m_items[index].text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     int ListBox::getIndexById(const String& id) const
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return static_cast<int>(i);
-        }
+        const auto it = m_idIndices.find(id);
+        if (it != m_idIndices.end())
+            return static_cast<int>(it->second);
 
         return -1;
     }
@@ -327,7 +342,7 @@ namespace tgui
 
     String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[static_cast<std::size_t>(m_selectedItem)].text.getString() : "";
+        return (m_selectedItem >= 0) ? m_items[static_cast<std::size_t>(m_selectedItem)].text : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -348,11 +363,9 @@ namespace tgui
 
     bool ListBox::changeItem(const String& originalValue, const String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].text.getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        const auto it = m_itemIndices.find(originalValue);
+        if (it != m_itemIndices.end())
+            return changeItemByIndex(it->second, newValue);
 
         return false;
     }
@@ -361,11 +374,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const String& id, const String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const auto it = m_idIndices.find(id);
+        if (it != m_idIndices.end())
+            return changeItemByIndex(it->second, newValue);
 
         return false;
     }
@@ -377,7 +388,53 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
-        m_items[index].text.setString(newValue);
+        const auto it = m_itemIndices.find(m_items[index].text);
+        if ((it != m_itemIndices.end()) && (it->second == index))
+        {
+            // Another item with the same text may now be the first one with that text
+            std::size_t nextIndex = index + 1;
+            while ((nextIndex < m_items.size()) && (m_items[nextIndex].text != m_items[index].text))
+                ++nextIndex;
+
+            if (nextIndex < m_items.size())
+                it->second = nextIndex;
+            else
+                m_itemIndices.erase(it);
+        }
+
+        m_items[index].text = newValue;
+
+        const auto newIt = m_itemIndices.find(newValue);
+        if (newIt == m_itemIndices.end())
+            m_itemIndices[newValue] = index;
+        else if (newIt->second > index)
+            newIt->second = index;
+
+        if (m_filterIndexValid)
+            changeItemInFilterIndex(index);
+        if (!m_lowerCaseFilter.empty())
+        {
+            // The item may have to be shown or hidden, which moves the items below it
+            const auto filteredIt = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            const bool wasShown = (filteredIt != m_filteredItems.end()) && (*filteredIt == index);
+            const bool isShown = itemMatchesFilter(index);
+            if (wasShown != isShown)
+            {
+                if (isShown)
+                    m_filteredItems.insert(filteredIt, index);
+                else
+                    m_filteredItems.erase(filteredIt);
+
+                if (m_hoveringItem >= static_cast<int>(index))
+                    updateHoveringItem(-1);
+
+                m_visibleTexts.erase(m_visibleTexts.lower_bound(index), m_visibleTexts.end());
+                m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
+                triggerOnScroll();
+            }
+        }
+
+        invalidateItemText(static_cast<int>(index));
         return true;
     }
 
@@ -393,8 +450,9 @@ namespace tgui
     std::vector<String> ListBox::getItems() const
     {
         std::vector<String> items;
+        items.reserve(m_items.size());
         for (const auto& item : m_items)
-            items.push_back(item.text.getString());
+            items.push_back(item.text);
 
         return items;
     }
@@ -404,6 +462,7 @@ namespace tgui
     std::vector<String> ListBox::getItemIds() const
     {
         std::vector<String> ids;
+        ids.reserve(m_items.size());
         for (const auto& item : m_items)
             ids.push_back(item.id);
 
@@ -431,14 +490,10 @@ namespace tgui
         m_itemHeight = itemHeight;
 
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-        {
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.text.setCharacterSize(m_textSizeCached);
-        }
 
         m_scroll->setScrollAmount(m_itemHeight);
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
         updateItemPositions();
         triggerOnScroll();
     }
@@ -457,9 +512,6 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.text.setCharacterSize(m_textSizeCached);
-
         updateItemPositions();
     }
 
@@ -480,8 +532,9 @@ namespace tgui
 
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(m_maxItems), m_items.end());
+            rebuildIndices();
 
-            m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+            m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
             updateItemPositions();
             triggerOnScroll();
         }
@@ -526,14 +579,63 @@ namespace tgui
 
     bool ListBox::contains(const String& itemStr) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [itemStr](const Item& item){ return item.text.getString() == itemStr; }) != m_items.end();
+        return m_itemIndices.find(itemStr) != m_itemIndices.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const String& id) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [id](const Item& item){ return item.id == id; }) != m_items.end();
+        return m_idIndices.find(id) != m_idIndices.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilter(const String& filter)
+    {
+        m_filter = filter;
+
+        const String lowerCaseFilter = filter.toLower();
+        if (lowerCaseFilter == m_lowerCaseFilter)
+            return;
+
+        // While typing, the items that match the new filter are a subset of the items that matched the previous filter
+        const bool onlyCheckFilteredItems = !m_lowerCaseFilter.empty() && (lowerCaseFilter.find(m_lowerCaseFilter) != String::npos);
+        m_lowerCaseFilter = lowerCaseFilter;
+        updateFilteredItems(onlyCheckFilteredItems);
+
+        updateHoveringItem(-1);
+        m_visibleTexts.clear();
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
+        m_scroll->setValue(0);
+        triggerOnScroll();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& ListBox::getFilter() const
+    {
+        return m_filter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListBox::getFilteredItemIndices() const
+    {
+        if (!m_lowerCaseFilter.empty())
+            return m_filteredItems;
+
+        std::vector<std::size_t> indices(m_items.size());
+        std::iota(indices.begin(), indices.end(), std::size_t(0));
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getFilteredItemCount() const
+    {
+        return m_lowerCaseFilter.empty() ? m_items.size() : m_filteredItems.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -586,9 +688,9 @@ namespace tgui
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
                 // NOLINTNEXTLINE(bugprone-integer-division)
-                const int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if ((hoveringRow >= 0) && (hoveringRow < static_cast<int>(getFilteredItemCount())))
+                    updateHoveringItem(static_cast<int>(getItemIndexFromRow(static_cast<std::size_t>(hoveringRow))));
                 else
                     updateHoveringItem(-1);
 
@@ -603,7 +705,7 @@ namespace tgui
                 if (m_selectedItem >= 0)
                 {
                     const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-                    onMousePress.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+                    onMousePress.emit(this, m_selectedItem, selectedItem.text, selectedItem.id);
                 }
             }
         }
@@ -620,7 +722,7 @@ namespace tgui
             if (m_selectedItem >= 0)
             {
                 const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-                onMouseRelease.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+                onMouseRelease.emit(this, m_selectedItem, selectedItem.text, selectedItem.id);
             }
 
             // Check if you double-clicked
@@ -631,7 +733,7 @@ namespace tgui
                 if (m_selectedItem >= 0)
                 {
                     const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-                    onDoubleClick.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+                    onDoubleClick.emit(this, m_selectedItem, selectedItem.text, selectedItem.id);
                 }
             }
             else // This is the first click
@@ -675,9 +777,9 @@ namespace tgui
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
                 // NOLINTNEXTLINE(bugprone-integer-division)
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if ((hoveringRow >= 0) && (hoveringRow < static_cast<int>(getFilteredItemCount())))
+                    updateHoveringItem(static_cast<int>(getItemIndexFromRow(static_cast<std::size_t>(hoveringRow))));
                 else
                     updateHoveringItem(-1);
 
@@ -738,14 +840,17 @@ namespace tgui
     void ListBox::keyPressed(const Event::KeyEvent& event)
     {
         Widget::keyPressed(event);
-        if (event.code == Event::KeyboardKey::Up && (m_selectedItem > 0))
+
+        // Move between the displayed rows, which may skip items when a filter is set
+        const int selectedRow = getRowFromItemIndex(m_selectedItem);
+        if (event.code == Event::KeyboardKey::Up && (selectedRow > 0))
         {
-            setSelectedItemByIndex(static_cast<std::size_t>(m_selectedItem - 1));
+            setSelectedItemByIndex(getItemIndexFromRow(static_cast<std::size_t>(selectedRow - 1)));
         }
         else if ((event.code == Event::KeyboardKey::Down)
-              && (m_selectedItem >= 0) && (static_cast<std::size_t>(m_selectedItem) + 1 < m_items.size()))
+              && (selectedRow >= 0) && (static_cast<std::size_t>(selectedRow) + 1 < getFilteredItemCount()))
         {
-            setSelectedItemByIndex(static_cast<std::size_t>(m_selectedItem) + 1);
+            setSelectedItemByIndex(getItemIndexFromRow(static_cast<std::size_t>(selectedRow) + 1));
         }
     }
 
@@ -818,24 +923,12 @@ namespace tgui
         else if (property == U"TextStyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
+            m_visibleTexts.clear();
         }
         else if (property == U"SelectedTextStyle")
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
-            }
+            invalidateItemText(m_selectedItem);
         }
         else if (property == U"Scrollbar")
         {
@@ -880,23 +973,15 @@ namespace tgui
 
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
+            m_visibleTexts.clear();
         }
         else if (property == U"Font")
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
                 m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSizeCached);
-            }
 
             updateItemPositions();
         }
@@ -1021,46 +1106,339 @@ namespace tgui
 
     void ListBox::updateItemPositions()
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].text.getSize().y) / 2.0f)});
+        // The texts of the items are positioned when they are created
+        m_visibleTexts.clear();
 
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    const Text& ListBox::getItemText(std::size_t index) const
     {
-        if (m_selectedItem >= 0)
+        const auto it = m_visibleTexts.find(index);
+        if (it != m_visibleTexts.end())
+            return it->second;
+
+        Color color = m_textColorCached;
+        TextStyles style = m_textStyleCached;
+        if (static_cast<int>(index) == m_selectedItem)
         {
-            Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
             if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                selectedItem.text.setColor(m_selectedTextColorHoverCached);
+                color = m_selectedTextColorHoverCached;
             else if (m_selectedTextColorCached.isSet())
-                selectedItem.text.setColor(m_selectedTextColorCached);
+                color = m_selectedTextColorCached;
 
             if (m_selectedTextStyleCached.isSet())
-                selectedItem.text.setStyle(m_selectedTextStyleCached);
+                style = m_selectedTextStyleCached;
+        }
+        else if ((static_cast<int>(index) == m_hoveringItem) && m_textColorHoverCached.isSet())
+            color = m_textColorHoverCached;
+
+        Text text;
+        text.setFont(m_fontCached);
+        text.setColor(color);
+        text.setOpacity(m_opacityCached);
+        text.setStyle(style);
+        text.setCharacterSize(m_textSizeCached);
+        text.setString(m_items[index].text);
+        const auto row = static_cast<std::size_t>(getRowFromItemIndex(static_cast<int>(index)));
+        text.setPosition({0, (row * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+        return m_visibleTexts.emplace(index, std::move(text)).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::invalidateItemText(int index)
+    {
+        if (index >= 0)
+            m_visibleTexts.erase(static_cast<std::size_t>(index));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::addItemToIndices(std::size_t index)
+    {
+        // If there already is an item with the same text or id then it has a lower index and the table isn't changed
+        m_itemIndices.emplace(m_items[index].text, index);
+        m_idIndices.emplace(m_items[index].id, index);
+
+        if (m_filterIndexValid)
+            addItemToFilterIndex(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::removeItemFromIndices(std::size_t index)
+    {
+        const auto updateIndices = [this, index](std::unordered_map<String, std::size_t, priv::StringHash>& indices, String Item::*key){
+            const String& removedKey = m_items[index].*key;
+            const auto it = indices.find(removedKey);
+            if ((it != indices.end()) && (it->second == index))
+            {
+                // Look for the next item with the same key, or remove the key if there is none
+                std::size_t nextIndex = index + 1;
+                while ((nextIndex < m_items.size()) && (m_items[nextIndex].*key != removedKey))
+                    ++nextIndex;
+
+                if (nextIndex < m_items.size())
+                    it->second = nextIndex;
+                else
+                    indices.erase(it);
+            }
+
+            // All items behind the removed item will move one place. The indices are updated in place, so none of the
+            // keys have to be hashed again.
+            for (auto& pair : indices)
+            {
+                if (pair.second > index)
+                    --pair.second;
+            }
+        };
+
+        updateIndices(m_itemIndices, &Item::text);
+        updateIndices(m_idIndices, &Item::id);
+
+        if (!m_lowerCaseFilter.empty())
+        {
+            const auto filteredIt = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            if ((filteredIt != m_filteredItems.end()) && (*filteredIt == index))
+                m_filteredItems.erase(filteredIt);
+
+            for (auto& filteredIndex : m_filteredItems)
+            {
+                if (filteredIndex > index)
+                    --filteredIndex;
+            }
+        }
+
+        if (m_filterIndexValid)
+            removeItemFromFilterIndex(index);
+
+        // The items behind the removed one will get a different position
+        m_visibleTexts.erase(m_visibleTexts.lower_bound(index), m_visibleTexts.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::rebuildIndices()
+    {
+        m_itemIndices.clear();
+        m_idIndices.clear();
+        m_visibleTexts.clear();
+        invalidateFilterIndex();
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            addItemToIndices(i);
+
+        updateFilteredItems(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getItemIndexFromRow(std::size_t row) const
+    {
+        return m_lowerCaseFilter.empty() ? row : m_filteredItems[row];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getRowFromItemIndex(int index) const
+    {
+        if ((index < 0) || m_lowerCaseFilter.empty())
+            return index;
+
+        const auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), static_cast<std::size_t>(index));
+        if ((it == m_filteredItems.end()) || (*it != static_cast<std::size_t>(index)))
+            return -1;
+
+        return static_cast<int>(it - m_filteredItems.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::itemMatchesFilter(std::size_t index) const
+    {
+        if (m_filterIndexValid)
+            return m_lowerCaseItems[index].find(m_lowerCaseFilter) != String::npos;
+        else
+            return m_items[index].text.toLower().find(m_lowerCaseFilter) != String::npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateFilteredItems(bool onlyCheckFilteredItems)
+    {
+        if (m_lowerCaseFilter.empty())
+        {
+            m_filteredItems.clear();
+            return;
+        }
+
+        if (!m_filterIndexValid)
+        {
+            m_lowerCaseItems.reserve(m_items.size());
+            m_filterKeys.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                addItemToFilterIndex(i);
+
+            m_filterIndexValid = true;
+        }
+
+        std::vector<std::size_t> candidates;
+        if (onlyCheckFilteredItems)
+            candidates = std::move(m_filteredItems);
+        else if (m_lowerCaseFilter.length() >= 3)
+        {
+            // Only items that contain every 3-character sequence of the filter can match it
+            std::vector<const std::vector<std::size_t>*> postings;
+            for (std::size_t i = 0; i + 3 <= m_lowerCaseFilter.length(); ++i)
+            {
+                const auto it = m_trigramIndex.find(getTrigramKey(m_lowerCaseFilter, i));
+                if (it == m_trigramIndex.end())
+                {
+                    postings.clear();
+                    break;
+                }
+
+                postings.push_back(&it->second);
+            }
+
+            if (!postings.empty())
+            {
+                // Start from the rarest sequence so that the intersections stay small
+                std::sort(postings.begin(), postings.end(),
+                          [](const std::vector<std::size_t>* left, const std::vector<std::size_t>* right){ return left->size() < right->size(); });
+
+                std::vector<std::size_t> keys = *postings[0];
+                for (std::size_t i = 1; (i < postings.size()) && !keys.empty(); ++i)
+                {
+                    std::vector<std::size_t> intersection;
+                    std::set_intersection(keys.begin(), keys.end(), postings[i]->begin(), postings[i]->end(), std::back_inserter(intersection));
+                    keys = std::move(intersection);
+                }
+
+                // The keys are sorted in the same order as the items, so each search can continue where the previous one ended
+                candidates.reserve(keys.size());
+                auto keyIt = m_filterKeys.cbegin();
+                for (const auto key : keys)
+                {
+                    keyIt = std::lower_bound(keyIt, m_filterKeys.cend(), key);
+                    candidates.push_back(static_cast<std::size_t>(keyIt - m_filterKeys.cbegin()));
+                }
+            }
+        }
+        else
+        {
+            candidates.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                candidates.push_back(i);
         }
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
+        m_filteredItems.clear();
+        for (const auto index : candidates)
         {
-            if (m_textColorHoverCached.isSet())
-                m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_textColorHoverCached);
+            if (m_lowerCaseItems[index].find(m_lowerCaseFilter) != String::npos)
+                m_filteredItems.push_back(index);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    void ListBox::addItemToFilterIndex(std::size_t index)
     {
-        for (auto& item : m_items)
+        m_lowerCaseItems.push_back(m_items[index].text.toLower());
+        m_filterKeys.push_back(m_nextFilterKey++);
+
+        const std::size_t key = m_filterKeys.back();
+        const String& str = m_lowerCaseItems.back();
+        for (std::size_t i = 0; i + 3 <= str.length(); ++i)
         {
-            item.text.setColor(m_textColorCached);
-            item.text.setStyle(m_textStyleCached);
+            // A sequence can occur multiple times in the same item, but the item should only be listed once
+            auto& keys = m_trigramIndex[getTrigramKey(str, i)];
+            if (keys.empty() || (keys.back() != key))
+                keys.push_back(key);
         }
+    }
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::changeItemInFilterIndex(std::size_t index)
+    {
+        eraseItemTrigrams(index);
+        m_lowerCaseItems[index] = m_items[index].text.toLower();
+        insertItemTrigrams(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::removeItemFromFilterIndex(std::size_t index)
+    {
+        // The trigram lists contain keys instead of indices, so the items behind the removed one don't need to be updated
+        eraseItemTrigrams(index);
+        m_lowerCaseItems.erase(m_lowerCaseItems.begin() + static_cast<std::ptrdiff_t>(index));
+        m_filterKeys.erase(m_filterKeys.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::insertItemTrigrams(std::size_t index)
+    {
+        const std::size_t key = m_filterKeys[index];
+        const String& str = m_lowerCaseItems[index];
+        for (std::size_t i = 0; i + 3 <= str.length(); ++i)
+        {
+            auto& keys = m_trigramIndex[getTrigramKey(str, i)];
+            const auto it = std::lower_bound(keys.begin(), keys.end(), key);
+            if ((it == keys.end()) || (*it != key))
+                keys.insert(it, key);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::eraseItemTrigrams(std::size_t index)
+    {
+        const std::size_t key = m_filterKeys[index];
+        const String& str = m_lowerCaseItems[index];
+        for (std::size_t i = 0; i + 3 <= str.length(); ++i)
+        {
+            const auto listIt = m_trigramIndex.find(getTrigramKey(str, i));
+            if (listIt == m_trigramIndex.end())
+                continue;
+
+            auto& keys = listIt->second;
+            const auto it = std::lower_bound(keys.begin(), keys.end(), key);
+            if ((it != keys.end()) && (*it == key))
+                keys.erase(it);
+            if (keys.empty())
+                m_trigramIndex.erase(listIt);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::invalidateFilterIndex()
+    {
+        m_filterIndexValid = false;
+        m_lowerCaseItems.clear();
+        m_filterKeys.clear();
+        m_nextFilterKey = 0;
+        m_trigramIndex.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    {
+        invalidateItemText(m_selectedItem);
+        invalidateItemText(m_hoveringItem);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemColorsAndStyle()
+    {
+        m_visibleTexts.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1069,14 +1447,7 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_selectedTextColorCached);
-                else
-                    m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_textColorCached);
-            }
-
+            invalidateItemText(m_hoveringItem);
             m_hoveringItem = item;
 
             updateSelectedAndHoveringItemColorsAndStyle();
@@ -1090,22 +1461,13 @@ namespace tgui
         if (m_selectedItem == item)
             return;
 
-        if (m_selectedItem >= 0)
-        {
-            Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-            if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                selectedItem.text.setColor(m_textColorHoverCached);
-            else
-                selectedItem.text.setColor(m_textColorCached);
-
-            selectedItem.text.setStyle(m_textStyleCached);
-        }
+        invalidateItemText(m_selectedItem);
 
         m_selectedItem = item;
         if (m_selectedItem >= 0)
         {
             const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-            onItemSelect.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+            onItemSelect.emit(this, m_selectedItem, selectedItem.text, selectedItem.id);
         }
         else
             onItemSelect.emit(this, m_selectedItem, "", "");
@@ -1168,8 +1530,9 @@ namespace tgui
             target.addClippingLayer(states, {{m_paddingCached.getLeft(), m_paddingCached.getTop()}, {maxItemWidth, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}});
 
             // Find out which items are visible
+            const std::size_t rowCount = getFilteredItemCount();
             std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            std::size_t lastItem = rowCount;
             if (m_scroll->getViewportSize() < m_scroll->getMaximum())
             {
                 firstItem = m_scroll->getValue() / m_itemHeight;
@@ -1180,12 +1543,20 @@ namespace tgui
                     ++lastItem;
             }
 
+            // Forget the texts of items that are no longer near the visible area
+            const std::size_t margin = std::max<std::size_t>(lastItem - firstItem, 1);
+            const std::size_t firstKeptRow = (firstItem > margin) ? firstItem - margin : 0;
+            const std::size_t lastKeptRow = lastItem + margin;
+            m_visibleTexts.erase(m_visibleTexts.begin(), m_visibleTexts.lower_bound((firstKeptRow < rowCount) ? getItemIndexFromRow(firstKeptRow) : m_items.size()));
+            m_visibleTexts.erase(m_visibleTexts.lower_bound((lastKeptRow < rowCount) ? getItemIndexFromRow(lastKeptRow) : m_items.size()), m_visibleTexts.end());
+
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            const int selectedRow = getRowFromItemIndex(m_selectedItem);
+            if (selectedRow >= 0)
             {
-                states.transform.translate({0, m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, selectedRow * static_cast<float>(m_itemHeight)});
 
                 const Vector2f size = {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)};
                 if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
@@ -1193,15 +1564,16 @@ namespace tgui
                 else
                     target.drawFilledRect(states, size, Color::applyOpacity(m_selectedBackgroundColorCached, m_opacityCached));
 
-                states.transform.translate({0, -m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -selectedRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveringItem >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            const int hoveringRow = getRowFromItemIndex(m_hoveringItem);
+            if ((hoveringRow >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, hoveringRow * static_cast<float>(m_itemHeight)});
                 target.drawFilledRect(states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_backgroundColorHoverCached, m_opacityCached));
-                states.transform.translate({0, -m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -hoveringRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the items
@@ -1210,9 +1582,10 @@ namespace tgui
                 const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
                 for (std::size_t i = firstItem; i < lastItem; ++i)
                 {
-                    const float textWidth = m_items[i].text.getSize().x;
+                    const Text& text = getItemText(getItemIndexFromRow(i));
+                    const float textWidth = text.getSize().x;
                     states.transform.translate({maxItemWidth - textPadding - textWidth, 0});
-                    target.drawText(states, m_items[i].text);
+                    target.drawText(states, text);
                     states.transform.translate({-maxItemWidth + textPadding + textWidth, 0});
                 }
             }
@@ -1220,9 +1593,10 @@ namespace tgui
             {
                 for (std::size_t i = firstItem; i < lastItem; ++i)
                 {
-                    const float textWidth = m_items[i].text.getSize().x;
+                    const Text& text = getItemText(getItemIndexFromRow(i));
+                    const float textWidth = text.getSize().x;
                     states.transform.translate({(maxItemWidth - textWidth) / 2.f, 0});
-                    target.drawText(states, m_items[i].text);
+                    target.drawText(states, text);
                     states.transform.translate({-(maxItemWidth - textWidth) / 2.f, 0});
                 }
             }
@@ -1230,7 +1604,7 @@ namespace tgui
             {
                 states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), 0});
                 for (std::size_t i = firstItem; i < lastItem; ++i)
-                    target.drawText(states, m_items[i].text);
+                    target.drawText(states, getItemText(getItemIndexFromRow(i)));
             }
 
             target.removeClippingLayer();
@@ -28,6 +28,8 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <numeric>
     #include <cmath>
 #endif
 
@@ -369,6 +371,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const String& text)
     {
+        if (m_model)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while a model is set.");
+            return m_model->getRowCount();
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
@@ -377,10 +385,7 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToNewItem(m_items.size() - 1);
 
         return m_items.size()-1;
     }
@@ -389,6 +394,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<String>& itemTexts)
     {
+        if (m_model)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while a model is set.");
+            return m_model->getRowCount();
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -400,10 +411,7 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToNewItem(m_items.size() - 1);
 
         return m_items.size()-1;
     }
@@ -412,6 +420,12 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<String>>& items)
     {
+        if (m_model)
+        {
+            TGUI_PRINT_WARNING("ListView::addMultipleItems can't be used while a model is set.");
+            return;
+        }
+
         bool columnWidthChanged = false;
         for (const auto& itemToInsert : items)
         {
@@ -429,10 +443,7 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToNewItem(m_items.size() - 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,10 +465,7 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
-
-        // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        autoScrollToNewItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -482,10 +490,7 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
-
-        // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        autoScrollToNewItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,10 +521,7 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
-
-        // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        autoScrollToNewItem(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -610,7 +612,9 @@ namespace tgui
             {
                 m_selectedItems.erase(index);
                 setItemColor(index, m_textColorCached);
-                if (!m_selectedItems.empty())
+                if (m_updateDepth > 0)
+                    m_selectionChangedDuringUpdate = true;
+                else if (!m_selectedItems.empty())
                     onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
                 else
                     onItemSelect.emit(this, -1);
@@ -727,9 +731,60 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::beginUpdate()
+    {
+        ++m_updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::endUpdate()
+    {
+        if (m_updateDepth == 0)
+            return;
+
+        if (--m_updateDepth > 0)
+            return;
+
+        bool columnWidthChanged = m_columnWidthsOutdated;
+        if (m_widestItemOutdated)
+        {
+            m_widestItemOutdated = false;
+            columnWidthChanged |= updateWidestItem();
+        }
+
+        m_columnWidthsOutdated = false;
+        if (columnWidthChanged)
+            updateColumnWidths();
+
+        if (m_verticalScrollbarMaximumOutdated)
+        {
+            m_verticalScrollbarMaximumOutdated = false;
+            updateVerticalScrollbarMaximum();
+        }
+
+        if (m_autoScrollItemAfterUpdate != std::numeric_limits<std::size_t>::max())
+        {
+            // Items may have been removed after the item was added, in which case we scroll to the bottom
+            const std::size_t itemCount = getItemCount();
+            if (itemCount > 0)
+                autoScrollToNewItem(std::min(m_autoScrollItemAfterUpdate, itemCount - 1));
+
+            m_autoScrollItemAfterUpdate = std::numeric_limits<std::size_t>::max();
+        }
+
+        if (m_selectionChangedDuringUpdate)
+        {
+            m_selectionChangedDuringUpdate = false;
+            onItemSelect.emit(this, getSelectedItemIndex());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -847,16 +902,7 @@ namespace tgui
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items[index].icon.setTexture(texture);
 
-        Vector2f iconSize;
-        if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.y != 0))
-            iconSize = m_fixedIconSize;
-        else if ((m_fixedIconSize.y != 0) && (m_fixedIconSize.y != texture.getImageSize().y))
-            iconSize = {static_cast<float>(texture.getImageSize().x) / texture.getImageSize().y * m_fixedIconSize.y, static_cast<float>(m_fixedIconSize.y)};
-        else if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.x != texture.getImageSize().x))
-            iconSize = {static_cast<float>(m_fixedIconSize.x), static_cast<float>(texture.getImageSize().y) / texture.getImageSize().x * m_fixedIconSize.x};
-        else
-            iconSize = Vector2f{texture.getImageSize()};
-
+        const Vector2f iconSize = calculateIconSize(texture);
         m_items[index].icon.setSize(iconSize);
 
         if (m_items[index].icon.isSet())
@@ -894,7 +940,9 @@ namespace tgui
 
     Texture ListView::getItemIcon(std::size_t index) const
     {
-        if (index < m_items.size())
+        if (m_model && (index < m_model->getRowCount()))
+            return m_model->getIcon(index);
+        else if (index < m_items.size())
             return m_items[index].icon.getTexture();
         else
         {
@@ -907,19 +955,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_model)
+            return m_model->getRowCount();
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_model)
+            return m_model->getCell(rowIndex, columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -930,6 +984,9 @@ namespace tgui
 
     String ListView::getItem(std::size_t index) const
     {
+        if (m_model)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -944,7 +1001,15 @@ namespace tgui
     std::vector<String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<String> row;
-        if (index < m_items.size())
+        if (m_model)
+        {
+            if (index < m_model->getRowCount())
+            {
+                for (std::size_t i = 0; i < std::max<std::size_t>(1, m_columns.size()); ++i)
+                    row.push_back(m_model->getCell(index, i));
+            }
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -961,31 +1026,216 @@ namespace tgui
         if (index >= m_items.size())
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
-            {
-                String s1;
-                if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+        // Copy the strings only once instead of extracting them from the texts in every comparison
+        std::vector<String> keys(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (index < m_items[i].texts.size())
+                keys[i] = m_items[i].texts[index].getString();
+        }
+
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&keys, &cmp](std::size_t a, std::size_t b){ return cmp(keys[a], keys[b]); });
+        reorderItems(order);
+    }
 
-                String s2;
-                if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortNumerically(std::size_t columnIndex, bool ascending)
+    {
+        // Cells that don't contain a number get NaN as key, which the comparison places at the end
+        std::vector<float> keys(m_items.size(), std::numeric_limits<float>::quiet_NaN());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            float value = 0;
+            if ((columnIndex < m_items[i].texts.size()) && m_items[i].texts[columnIndex].getString().attemptToFloat(value))
+                keys[i] = value;
+        }
+
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::stable_sort(order.begin(), order.end(),
+            [&keys, ascending](std::size_t a, std::size_t b)
+            {
+                if (std::isnan(keys[a]))
+                    return false;
+                if (std::isnan(keys[b]))
+                    return true;
 
-                return cmp(s1, s2);
+                return ascending ? (keys[a] < keys[b]) : (keys[a] > keys[b]);
             });
 
-        // While the width of the widest item didn't change, its index might have, so we need to locate it again
-        updateWidestItem();
+        reorderItems(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortByKey(const std::function<double(std::size_t)>& keyFunc, bool ascending)
+    {
+        std::vector<double> keys(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            keys[i] = keyFunc(i);
+
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        if (ascending)
+            std::stable_sort(order.begin(), order.end(), [&keys](std::size_t a, std::size_t b){ return keys[a] < keys[b]; });
+        else
+            std::stable_sort(order.begin(), order.end(), [&keys](std::size_t a, std::size_t b){ return keys[a] > keys[b]; });
+
+        reorderItems(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setModel(std::shared_ptr<Model> model)
+    {
+        updateSelectedItem(-1);
+        updateHoveredItem(-1);
+        m_focusedItemIndex = -1;
+
+        m_items.clear();
+        m_modelItemCache.clear();
+        m_model = std::move(model);
+
+        m_iconCount = 0;
+        m_maxIconWidth = m_fixedIconSize.x;
+
+        if (updateWidestItem())
+            updateColumnWidths();
+
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<ListView::Model> ListView::getModel() const
+    {
+        return m_model;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::modelRowsInserted(std::size_t first, std::size_t count)
+    {
+        if (!m_model || (count == 0))
+            return;
+
+        // Cached rows behind the insertion point now have a different index
+        m_modelItemCache.erase(m_modelItemCache.lower_bound(first), m_modelItemCache.end());
+
+        const auto shiftIndex = [first, count](int& index){
+            if ((index >= 0) && (static_cast<std::size_t>(index) >= first))
+                index += static_cast<int>(count);
+        };
+        shiftIndex(m_hoveredItem);
+        shiftIndex(m_firstSelectedItemIndex);
+        shiftIndex(m_focusedItemIndex);
+
+        decltype(m_selectedItems) newSelectedItems;
+        for (const auto selectedItem : m_selectedItems)
+            newSelectedItems.insert((selectedItem >= first) ? selectedItem + count : selectedItem);
+        m_selectedItems = std::move(newSelectedItems);
+
+        updateVerticalScrollbarMaximum();
+        autoScrollToNewItem(first + count - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::modelRowsRemoved(std::size_t first, std::size_t count)
+    {
+        if (!m_model || (count == 0))
+            return;
+
+        // Cached rows behind the removed rows now have a different index
+        m_modelItemCache.erase(m_modelItemCache.lower_bound(first), m_modelItemCache.end());
+
+        const std::size_t last = first + count;
+        const auto shiftIndex = [first, last, count](int& index){
+            if (index < 0)
+                return;
+            if (static_cast<std::size_t>(index) >= last)
+                index -= static_cast<int>(count);
+            else if (static_cast<std::size_t>(index) >= first)
+                index = -1;
+        };
+        shiftIndex(m_hoveredItem);
+
+        bool selectionChanged = false;
+        decltype(m_selectedItems) newSelectedItems;
+        for (const auto selectedItem : m_selectedItems)
+        {
+            if (selectedItem < first)
+                newSelectedItems.insert(selectedItem);
+            else if (selectedItem >= last)
+                newSelectedItems.insert(selectedItem - count);
+            else
+                selectionChanged = true;
+        }
+        m_selectedItems = std::move(newSelectedItems);
+
+        shiftIndex(m_firstSelectedItemIndex);
+        if ((m_firstSelectedItemIndex < 0) && !m_selectedItems.empty())
+            m_firstSelectedItemIndex = static_cast<int>(*m_selectedItems.begin());
+
+        const int oldFocusedItemIndex = m_focusedItemIndex;
+        shiftIndex(m_focusedItemIndex);
+        if ((oldFocusedItemIndex >= 0) && (m_focusedItemIndex < 0))
+        {
+            // The focused item was removed, move the focus to a nearby item
+            const std::size_t rowCount = m_model->getRowCount();
+            if (first < rowCount)
+                m_focusedItemIndex = static_cast<int>(first);
+            else if (rowCount > 0)
+                m_focusedItemIndex = static_cast<int>(rowCount - 1);
+        }
+
+        updateVerticalScrollbarMaximum();
+
+        if (selectionChanged)
+        {
+            if (m_updateDepth > 0)
+                m_selectionChangedDuringUpdate = true;
+            else if (!m_selectedItems.empty())
+                onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
+            else
+                onItemSelect.emit(this, -1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::modelRowsChanged(std::size_t first, std::size_t count)
+    {
+        if (!m_model)
+            return;
+
+        m_modelItemCache.erase(m_modelItemCache.lower_bound(first), m_modelItemCache.lower_bound(first + count));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::modelReset()
+    {
+        if (!m_model)
+            return;
+
+        m_modelItemCache.clear();
+        updateSelectedItem(-1);
+        updateHoveredItem(-1);
+        m_focusedItemIndex = -1;
+        updateVerticalScrollbarMaximum();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<String> ListView::getItems() const
     {
-        std::vector<String> items(m_items.size());
+        std::vector<String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -996,6 +1246,15 @@ namespace tgui
     std::vector<std::vector<String>> ListView::getItemRows() const
     {
         std::vector<std::vector<String>> rows;
+        if (m_model)
+        {
+            const std::size_t rowCount = m_model->getRowCount();
+            rows.reserve(rowCount);
+            for (std::size_t i = 0; i < rowCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
 
         for (const auto& item : m_items)
         {
@@ -1037,6 +1296,7 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
+        m_modelItemCache.clear();
         for (auto& item : m_items)
         {
             for (auto& text : item.texts)
@@ -1307,6 +1567,7 @@ namespace tgui
 
         m_fixedIconSize = fixedIconSize;
         m_maxIconWidth = m_fixedIconSize.x; // If 0 then it will be changed below
+        m_modelItemCache.clear();
 
         if (m_iconCount == 0)
             return;
@@ -1316,18 +1577,7 @@ namespace tgui
             if (!item.icon.isSet())
                 continue;
 
-            const Texture& texture = item.icon.getTexture();
-
-            Vector2f iconSize;
-            if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.y != 0))
-                iconSize = m_fixedIconSize;
-            else if ((m_fixedIconSize.y != 0) && (m_fixedIconSize.y != texture.getImageSize().y))
-                iconSize = {static_cast<float>(texture.getImageSize().x) / texture.getImageSize().y * m_fixedIconSize.y, static_cast<float>(m_fixedIconSize.y)};
-            else if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.x != texture.getImageSize().x))
-                iconSize = {static_cast<float>(m_fixedIconSize.x), static_cast<float>(texture.getImageSize().y) / texture.getImageSize().x * m_fixedIconSize.x};
-            else
-                iconSize = Vector2f{texture.getImageSize()};
-
+            const Vector2f iconSize = calculateIconSize(item.icon.getTexture());
             item.icon.setSize(iconSize);
             m_maxIconWidth = std::max(m_maxIconWidth, iconSize.x);
         }
@@ -1669,7 +1919,7 @@ namespace tgui
             else // Only one item should be selected
                 setSelectedItem(indexAbove);
         }
-        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(m_items.size())))
+        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(getItemCount())))
         {
             const std::size_t indexBelow = (m_focusedItemIndex >= 0) ? static_cast<std::size_t>(m_focusedItemIndex) + 1 : 0;
             if (m_multiSelect && keyboard::isShiftPressed(event))
@@ -1692,8 +1942,16 @@ namespace tgui
             for (const std::size_t index : m_selectedItems)
             {
                 String temp;
-                for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                if (m_model)
+                {
+                    for (const auto& cell : getItemRow(index))
+                        temp.append(cell + '\t');
+                }
+                else
+                {
+                    for (const auto& text : m_items[index].texts)
+                        temp.append(text.getString() + '\t');
+                }
 
                 if (*temp.rbegin() == '\t')
                     temp.pop_back();
@@ -1846,6 +2104,7 @@ namespace tgui
             for (auto& column : m_columns)
                 column.text.setOpacity(m_opacityCached);
 
+            m_modelItemCache.clear();
             for (auto& item : m_items)
             {
                 for (auto& text : item.texts)
@@ -1861,6 +2120,7 @@ namespace tgui
             for (auto& column : m_columns)
                 column.text.setFont(m_fontCached);
 
+            m_modelItemCache.clear();
             for (auto& item : m_items)
             {
                 for (auto& text : item.texts)
@@ -2177,7 +2437,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const String& caption)
+    Text ListView::createText(const String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -2210,6 +2470,18 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
+        if (m_model)
+        {
+            // Rows that aren't cached will get the correct color when they are requested from the model
+            const auto it = m_modelItemCache.find(index);
+            if (it != m_modelItemCache.end())
+            {
+                for (auto& text : it->second.texts)
+                    text.setColor(color);
+            }
+            return;
+        }
+
         for (auto& text : m_items[index].texts)
             text.setColor(color);
     }
@@ -2247,6 +2519,9 @@ namespace tgui
         for (std::size_t i = 0; i < m_items.size(); ++i)
             setItemColor(i, m_textColorCached);
 
+        for (auto& pair : m_modelItemCache)
+            setItemColor(pair.first, m_textColorCached);
+
         updateSelectedAndhoveredItemColors();
     }
 
@@ -2348,6 +2623,13 @@ namespace tgui
     {
         assert((m_columns.empty() && (columnIndex == 0)) || (!m_columns.empty() && (columnIndex < m_columns.size())));
 
+        // Looping over all items is postponed until endUpdate is called
+        if (m_updateDepth > 0)
+        {
+            m_widestItemOutdated = true;
+            return false;
+        }
+
         // We don't track the width if the column isn't auto-resizing
         if (!m_columns.empty() && !m_columns[columnIndex].autoResize && (!m_expandLastColumn || (columnIndex + 1 != m_columns.size())))
         {
@@ -2475,6 +2757,12 @@ namespace tgui
 
     void ListView::updateColumnWidths()
     {
+        if (m_updateDepth > 0)
+        {
+            m_columnWidthsOutdated = true;
+            return;
+        }
+
         float totalColumnsWidth = 0;
         if (m_columns.empty())
             totalColumnsWidth = m_widestItemWidth;
@@ -2546,6 +2834,126 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::autoScrollToNewItem(std::size_t index)
+    {
+        if (!m_autoScroll)
+            return;
+
+        // The scrollbar maximum isn't updated yet, so we can only scroll once the update is finished
+        if (m_updateDepth > 0)
+        {
+            m_autoScrollItemAfterUpdate = index;
+            return;
+        }
+
+        if (index + 1 < getItemCount())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        else if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::reorderItems(const std::vector<std::size_t>& order)
+    {
+        assert(order.size() == m_items.size());
+
+        std::vector<Item> items;
+        items.reserve(m_items.size());
+        std::vector<std::size_t> newIndices(m_items.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            items.push_back(std::move(m_items[order[i]]));
+            newIndices[order[i]] = i;
+        }
+
+        m_items = std::move(items);
+
+        // The width of the widest item didn't change, but its index did
+        const auto updateIndex = [&newIndices](std::size_t& index){
+            if (index < newIndices.size())
+                index = newIndices[index];
+        };
+
+        updateIndex(m_widestItemIndex);
+        for (auto& column : m_columns)
+            updateIndex(column.widestItemIndex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f ListView::calculateIconSize(const Texture& texture) const
+    {
+        if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.y != 0))
+            return m_fixedIconSize;
+        else if ((m_fixedIconSize.y != 0) && (m_fixedIconSize.y != texture.getImageSize().y))
+            return {static_cast<float>(texture.getImageSize().x) / texture.getImageSize().y * m_fixedIconSize.y, static_cast<float>(m_fixedIconSize.y)};
+        else if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.x != texture.getImageSize().x))
+            return {static_cast<float>(m_fixedIconSize.x), static_cast<float>(texture.getImageSize().y) / texture.getImageSize().x * m_fixedIconSize.x};
+        else
+            return Vector2f{texture.getImageSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListView::Item& ListView::getItemForDrawing(std::size_t index) const
+    {
+        if (!m_model)
+            return m_items[index];
+
+        const auto it = m_modelItemCache.find(index);
+        if (it != m_modelItemCache.end())
+            return it->second;
+
+        Item item;
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        item.texts.reserve(columnCount);
+        for (std::size_t i = 0; i < columnCount; ++i)
+            item.texts.push_back(createText(m_model->getCell(index, i)));
+
+        const Texture icon = m_model->getIcon(index);
+        if (icon.getData())
+        {
+            item.icon.setTexture(icon);
+            item.icon.setSize(calculateIconSize(icon));
+            item.icon.setOpacity(m_opacityCached);
+        }
+
+        // Use the same text color as an item stored in the list view would have
+        const bool selected = (m_selectedItems.find(index) != m_selectedItems.end());
+        const bool hovered = (static_cast<int>(index) == m_hoveredItem);
+        Color color;
+        if (selected && hovered && m_selectedTextColorHoverCached.isSet())
+            color = m_selectedTextColorHoverCached;
+        else if (selected && m_selectedTextColorCached.isSet())
+            color = m_selectedTextColorCached;
+        else if (hovered && m_textColorHoverCached.isSet())
+            color = m_textColorHoverCached;
+
+        if (color.isSet())
+        {
+            for (auto& text : item.texts)
+                text.setColor(color);
+        }
+
+        return m_modelItemCache.emplace(index, std::move(item)).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::pruneModelItemCache(std::size_t firstVisibleItem, std::size_t lastVisibleItem) const
+    {
+        // Keep a page of rows above and below the visible ones, so that scrolling doesn't need to recreate them
+        const std::size_t margin = std::max<std::size_t>(lastVisibleItem - firstVisibleItem, 1);
+        const std::size_t first = (firstVisibleItem > margin) ? firstVisibleItem - margin : 0;
+        const std::size_t last = lastVisibleItem + margin;
+
+        m_modelItemCache.erase(m_modelItemCache.begin(), m_modelItemCache.lower_bound(first));
+        m_modelItemCache.erase(m_modelItemCache.lower_bound(last), m_modelItemCache.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::addSelectedItem(int item)
     {
         if (!m_multiSelect)
@@ -2615,7 +3023,7 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getItemCount())))
             updateHoveredItem(hoveredItem);
         else
             updateHoveredItem(-1);
@@ -2789,11 +3197,18 @@ namespace tgui
 
     void ListView::updateVerticalScrollbarMaximum()
     {
+        if (m_updateDepth > 0)
+        {
+            m_verticalScrollbarMaximumOutdated = true;
+            return;
+        }
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2852,16 +3267,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = getItemForDrawing(i);
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2879,7 +3295,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = getItemForDrawing(i);
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2889,12 +3306,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2938,16 +3355,20 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t itemCount = getItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
+        if (m_model)
+            pruneModelItemCache(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -2992,7 +3413,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
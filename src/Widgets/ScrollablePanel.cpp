@@ -331,6 +331,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Vector2f ScrollablePanel::getLayerOffset() const
+    {
+        return getContentOffset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float ScrollablePanel::getScrollbarWidth() const
     {
         return m_verticalScrollbar->getSize().x;
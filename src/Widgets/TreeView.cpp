@@ -28,6 +28,9 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <iterator>
+    #include <thread>
     #include <cmath>
 #endif
 
@@ -37,6 +40,69 @@ namespace tgui
 {
     namespace
     {
+        void insertNode(std::vector<std::shared_ptr<TreeView::Node>>& nodes,
+                        std::unordered_map<String, std::shared_ptr<TreeView::Node>, priv::StringHash>& nodesByText,
+                        std::shared_ptr<TreeView::Node> node)
+        {
+            // When multiple nodes have the same text, the lookup keeps pointing to the first one
+            nodesByText.emplace(node->text.getString(), node);
+            node->index = nodes.size();
+            nodes.push_back(std::move(node));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool eraseNode(std::vector<std::shared_ptr<TreeView::Node>>& nodes,
+                       std::unordered_map<String, std::shared_ptr<TreeView::Node>, priv::StringHash>& nodesByText,
+                       const TreeView::Node* node)
+        {
+            // The node no longer is at its stored position if it was already removed
+            if ((node->index >= nodes.size()) || (nodes[node->index].get() != node))
+                return false;
+
+            const auto it = nodes.begin() + static_cast<std::ptrdiff_t>(node->index);
+
+            const auto lookupIt = nodesByText.find(node->text.getString());
+            if ((lookupIt != nodesByText.end()) && (lookupIt->second.get() == node))
+            {
+                // A later sibling with the same text now becomes the one that is found by the lookup
+                const auto nextIt = std::find_if(std::next(it), nodes.end(),
+                    [node](const std::shared_ptr<TreeView::Node>& n){ return n->text.getString() == node->text.getString(); });
+                if (nextIt != nodes.end())
+                    lookupIt->second = *nextIt;
+                else
+                    nodesByText.erase(lookupIt);
+            }
+
+            // The siblings behind the removed node move one place
+            for (auto siblingIt = nodes.erase(it); siblingIt != nodes.end(); ++siblingIt)
+                --(*siblingIt)->index;
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isBranchNode(const TreeView::Node& node)
+        {
+            return !node.nodes.empty() || !node.childrenLoaded;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<String> getNodeHierarchy(const TreeView::Node* node)
+        {
+            std::vector<String> hierarchy;
+            while (node)
+            {
+                hierarchy.insert(hierarchy.begin(), node->text.getString());
+                node = node->parent;
+            }
+            return hierarchy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void setTextSizeImpl(std::vector<std::shared_ptr<TreeView::Node>>& nodes, unsigned int textSize)
         {
             for (auto& node : nodes)
@@ -80,9 +146,38 @@ namespace tgui
             newNode->depth = oldNode->depth;
             newNode->expanded = oldNode->expanded;
             newNode->parent = parent;
+            newNode->childrenLoaded = oldNode->childrenLoaded;
 
             for (const auto& oldChild : oldNode->nodes)
-                newNode->nodes.push_back(cloneNode(oldChild, newNode.get()));
+                insertNode(newNode->nodes, newNode->nodesByText, cloneNode(oldChild, newNode.get()));
+
+            return newNode;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::shared_ptr<TreeView::Node> findClonedNode(const std::vector<std::shared_ptr<TreeView::Node>>& oldRootNodes,
+                                                       const std::vector<std::shared_ptr<TreeView::Node>>& newRootNodes,
+                                                       const TreeView::Node* oldNode)
+        {
+            // Nodes are cloned in the same order, so the clone is found by following the same indices in the new tree
+            std::vector<std::size_t> indices;
+            for (const auto* node = oldNode; node; node = node->parent)
+            {
+                const auto& siblings = node->parent ? node->parent->nodes : oldRootNodes;
+                if ((node->index >= siblings.size()) || (siblings[node->index].get() != node))
+                    return nullptr;
+
+                indices.push_back(node->index);
+            }
+
+            std::shared_ptr<TreeView::Node> newNode;
+            const std::vector<std::shared_ptr<TreeView::Node>>* newSiblings = &newRootNodes;
+            for (auto it = indices.rbegin(); it != indices.rend(); ++it)
+            {
+                newNode = (*newSiblings)[*it];
+                newSiblings = &newNode->nodes;
+            }
 
             return newNode;
         }
@@ -125,38 +220,28 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool removeItemImpl(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<std::shared_ptr<TreeView::Node>>& nodes)
+        bool removeItemImpl(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex,
+                            std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::unordered_map<String, std::shared_ptr<TreeView::Node>, priv::StringHash>& nodesByText)
         {
-            for (auto it = nodes.begin(); it != nodes.end(); ++it)
-            {
-                if ((*it)->text.getString() != hierarchy[parentIndex])
-                    continue;
-
-                if (parentIndex + 1 == hierarchy.size())
-                {
-                    nodes.erase(it);
-                    return true;
-                }
-                else
-                {
-                    // Return false if some menu in the hierarchy couldn't be found
-                    if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, (*it)->nodes))
-                        return false;
-
-                    // If parents don't have to be removed as well then we are done
-                    if (!removeParentsWhenEmpty)
-                        return true;
+            const auto lookupIt = nodesByText.find(hierarchy[parentIndex]);
+            if (lookupIt == nodesByText.end())
+                return false; // The hierarchy doesn't exist
 
-                    // Also delete the parent if empty
-                    if ((*it)->nodes.empty())
-                        nodes.erase(it);
+            TreeView::Node* node = lookupIt->second.get();
+            if (parentIndex + 1 < hierarchy.size())
+            {
+                // Return false if some menu in the hierarchy couldn't be found
+                if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, node->nodes, node->nodesByText))
+                    return false;
 
+                // If parents don't have to be removed as well then we are done.
+                // Otherwise also delete the parent if empty.
+                if (!removeParentsWhenEmpty || !node->nodes.empty())
                     return true;
-                }
             }
 
-            // The hierarchy doesn't exist
-            return false;
+            eraseNode(nodes, nodesByText, node);
+            return true;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,19 +262,15 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        TreeView::Node* findNode(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, const std::vector<String>& hierarchy, unsigned int parentIndex)
+        std::shared_ptr<TreeView::Node> findNode(const std::unordered_map<String, std::shared_ptr<TreeView::Node>, priv::StringHash>& nodesByText, const std::vector<String>& hierarchy, unsigned int parentIndex)
         {
-            for (auto& node : nodes)
-            {
-                if (node->text.getString() != hierarchy[parentIndex])
-                    continue;
-                else if (parentIndex + 1 == hierarchy.size())
-                    return node.get();
-                else
-                    return findNode(node->nodes, hierarchy, parentIndex + 1);
-            }
-
-            return nullptr;
+            const auto it = nodesByText.find(hierarchy[parentIndex]);
+            if (it == nodesByText.end())
+                return nullptr;
+            else if (parentIndex + 1 == hierarchy.size())
+                return it->second;
+            else
+                return findNode(it->second->nodesByText, hierarchy, parentIndex + 1);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +350,9 @@ namespace tgui
         onExpand                            {other.onExpand},
         onCollapse                          {other.onCollapse},
         onRightClick                        {other.onRightClick},
+        m_childLoader                       {other.m_childLoader},
+        m_loadChildrenInBackground          {other.m_loadChildrenInBackground},
+        m_loadingItemText                   {other.m_loadingItemText},
         m_selectedItem                      {other.m_selectedItem},
         m_hoveredItem                       {other.m_hoveredItem},
         m_itemHeight                        {other.m_itemHeight},
@@ -295,12 +379,33 @@ namespace tgui
         m_textStyleCached                   {other.m_textStyleCached}
     {
         for (const auto& node : other.m_nodes)
-            m_nodes.push_back(cloneNode(node, nullptr));
+            insertNode(m_nodes, m_rootNodesByText, cloneNode(node, nullptr));
 
         m_visibleNodes.resize(other.m_visibleNodes.size(), nullptr);
         cloneVisibleNodeList(other.m_nodes, m_nodes, other.m_visibleNodes, m_visibleNodes);
 
         TGUI_ASSERT(std::count(m_visibleNodes.begin(), m_visibleNodes.end(), nullptr) == 0, "Cloned nodes can't contain a nullptr");
+
+        // Children that are still being loaded for the original tree view are requested again for the cloned nodes
+        for (const auto& load : other.m_backgroundLoads)
+        {
+            const auto oldNode = load.node.lock();
+            if (!oldNode)
+                continue;
+
+            BackgroundLoad newLoad;
+            newLoad.node = findClonedNode(other.m_nodes, m_nodes, oldNode.get());
+            if (newLoad.node.expired())
+                continue;
+
+            if (const auto oldPlaceholder = load.placeholder.lock())
+                newLoad.placeholder = findClonedNode(other.m_nodes, m_nodes, oldPlaceholder.get());
+
+            if (load.children.valid())
+                newLoad.children = startBackgroundLoad(getNodeHierarchy(oldNode.get()));
+
+            m_backgroundLoads.push_back(std::move(newLoad));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,6 +424,7 @@ namespace tgui
             std::swap(onRightClick,                         temp.onRightClick);
             std::swap(m_nodes,                              temp.m_nodes);
             std::swap(m_visibleNodes,                       temp.m_visibleNodes);
+            std::swap(m_rootNodesByText,                    temp.m_rootNodesByText);
             std::swap(m_selectedItem,                       temp.m_selectedItem);
             std::swap(m_hoveredItem,                        temp.m_hoveredItem);
             std::swap(m_itemHeight,                         temp.m_itemHeight);
@@ -343,6 +449,11 @@ namespace tgui
             std::swap(m_selectedBackgroundColorHoverCached, temp.m_selectedBackgroundColorHoverCached);
             std::swap(m_backgroundColorHoverCached,         temp.m_backgroundColorHoverCached);
             std::swap(m_textStyleCached,                    temp.m_textStyleCached);
+            std::swap(m_childLoader,                        temp.m_childLoader);
+            std::swap(m_loadChildrenInBackground,           temp.m_loadChildrenInBackground);
+            std::swap(m_loadingItemText,                    temp.m_loadingItemText);
+            std::swap(m_backgroundLoads,                    temp.m_backgroundLoads);
+            std::swap(m_childLoadWorker,                    temp.m_childLoadWorker);
         }
 
         return *this;
@@ -464,20 +575,11 @@ namespace tgui
                 return false;
         }
 
-        auto* node = findNode(m_nodes, hierarchy, 0);
+        const auto node = findNode(m_rootNodesByText, hierarchy, 0);
         if (!node)
             return false;
 
-        for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
-        {
-            if (m_visibleNodes[i].get() == node)
-            {
-                updateSelectedItem(static_cast<int>(i));
-                return true;
-            }
-        }
-
-        return false;
+        return selectVisibleNode(node.get());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,7 +593,10 @@ namespace tgui
 
     bool TreeView::removeItem(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty)
     {
-        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
+        if (hierarchy.empty())
+            return false;
+
+        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes, m_rootNodesByText);
         markNodesDirty();
         return ret;
     }
@@ -501,6 +606,7 @@ namespace tgui
     void TreeView::removeAllItems()
     {
         m_nodes.clear();
+        m_rootNodesByText.clear();
         markNodesDirty();
     }
 
@@ -531,25 +637,26 @@ namespace tgui
         if (index >= m_visibleNodes.size())
             return;
 
-        if (m_visibleNodes[index]->nodes.empty())
+        const auto node = m_visibleNodes[index];
+        if (!isBranchNode(*node))
             return;
 
-        std::vector<String> hierarchy;
-        auto* node = m_visibleNodes[index].get();
-        assert(node != nullptr);
-        while (node)
+        const std::vector<String> hierarchy = getNodeHierarchy(node.get());
+
+        node->expanded = !node->expanded;
+        if (node->expanded)
         {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
-            node = node->parent;
-        }
+            if (!node->childrenLoaded)
+                loadChildren(node.get());
 
-        m_visibleNodes[index]->expanded = !m_visibleNodes[index]->expanded;
-        if (m_visibleNodes[index]->expanded)
+            showChildNodes(index);
             onExpand.emit(this, hierarchy.back(), hierarchy);
+        }
         else
+        {
+            hideChildNodes(index);
             onCollapse.emit(this, hierarchy.back(), hierarchy);
-
-        markNodesDirty();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -590,6 +697,177 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TreeView::ItemHandle TreeView::addChildItem(const ItemHandle& parent, const String& text)
+    {
+        if (parent.m_root)
+        {
+            createNode(m_nodes, nullptr, text);
+            markNodesDirty();
+            return ItemHandle{m_nodes.back(), this};
+        }
+
+        const auto parentNode = getNodeFromHandle(parent);
+        if (!parentNode)
+            return {};
+
+        createNode(parentNode->nodes, parentNode.get(), text);
+        markNodesDirty();
+        return ItemHandle{parentNode->nodes.back(), this};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::ItemHandle TreeView::addLazyChildItem(const ItemHandle& parent, const String& text)
+    {
+        auto item = addChildItem(parent, text);
+
+        // The new node has no children yet, so changing its state doesn't affect the visible nodes
+        const auto node = getNodeFromHandle(item);
+        if (node)
+        {
+            node->expanded = false;
+            node->childrenLoaded = false;
+        }
+
+        return item;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setChildLoader(const ChildLoader& loader, bool loadInBackground)
+    {
+        m_childLoader = loader;
+        m_loadChildrenInBackground = loadInBackground;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setLoadingItemText(const String& text)
+    {
+        m_loadingItemText = text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& TreeView::getLoadingItemText() const
+    {
+        return m_loadingItemText;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::waitForChildLoads()
+    {
+        for (const auto& load : m_backgroundLoads)
+        {
+            if (load.children.valid())
+                load.children.wait();
+        }
+
+        if (!m_backgroundLoads.empty())
+            finishBackgroundLoads();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::ItemHandle TreeView::getItemHandle(const std::vector<String>& hierarchy) const
+    {
+        if (hierarchy.empty())
+            return {};
+
+        const auto node = findNode(m_rootNodesByText, hierarchy, 0);
+        if (!node)
+            return {};
+
+        return ItemHandle{node, this};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::ItemHandle TreeView::getSelectedItemHandle() const
+    {
+        if (m_selectedItem < 0)
+            return {};
+
+        return ItemHandle{m_visibleNodes[static_cast<std::size_t>(m_selectedItem)], this};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::expand(const ItemHandle& item)
+    {
+        const auto node = getNodeFromHandle(item);
+        if (node)
+            expandOrCollapseNode(node.get(), true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::collapse(const ItemHandle& item)
+    {
+        const auto node = getNodeFromHandle(item);
+        if (node)
+            expandOrCollapseNode(node.get(), false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::selectItem(const ItemHandle& item)
+    {
+        const auto node = getNodeFromHandle(item);
+        if (!node)
+            return false;
+
+        // Make sure the parent of the item we are selecting is expanded
+        if (node->parent)
+            expandOrCollapseNode(node->parent, true);
+
+        return selectVisibleNode(node.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::removeItem(const ItemHandle& item, bool removeParentsWhenEmpty)
+    {
+        // Keep the node alive until we are done with it
+        const auto lockedNode = getNodeFromHandle(item);
+        if (!lockedNode)
+            return false;
+
+        Node* node = lockedNode.get();
+        while (true)
+        {
+            Node* parent = node->parent;
+            const bool erased = parent ? eraseNode(parent->nodes, parent->nodesByText, node) : eraseNode(m_nodes, m_rootNodesByText, node);
+            if (!erased)
+            {
+                // This can only happen for the item itself, the nodes above it are always part of the tree
+                TGUI_ASSERT(node == lockedNode.get(), "Parent of a node in the tree view has to be in the tree as well");
+                return false;
+            }
+
+            if (!parent || !removeParentsWhenEmpty || !parent->nodes.empty())
+                break;
+
+            node = parent;
+        }
+
+        markNodesDirty();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TreeView::Node> TreeView::getNodeFromHandle(const ItemHandle& item) const
+    {
+        if (item.m_owner != this)
+            return nullptr;
+
+        return item.m_node.lock();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::setItemHeight(unsigned int itemHeight)
     {
         m_itemHeight = itemHeight;
@@ -916,10 +1194,10 @@ namespace tgui
         {
             // If item is an expanded node then collapse it. Otherwise select the parent node, or the previous sibling node if it has no parent.
             TGUI_ASSERT(selectedItemIdx <= m_visibleNodes.size(), "Selected item index has to be in range");
-            if (!m_visibleNodes[selectedItemIdx]->nodes.empty() && m_visibleNodes[selectedItemIdx]->expanded)
+            if (isBranchNode(*m_visibleNodes[selectedItemIdx]) && m_visibleNodes[selectedItemIdx]->expanded)
             {
                 m_visibleNodes[selectedItemIdx]->expanded = false;
-                markNodesDirty();
+                hideChildNodes(selectedItemIdx);
             }
             else if (m_visibleNodes[selectedItemIdx]->parent)
             {
@@ -959,10 +1237,13 @@ namespace tgui
         {
             // If item is a collapsed node then expand it. Otherwise simply select the next item.
             TGUI_ASSERT(selectedItemIdx <= m_visibleNodes.size(), "Selected item index has to be in range");
-            if (!m_visibleNodes[selectedItemIdx]->nodes.empty() && !m_visibleNodes[selectedItemIdx]->expanded)
+            if (isBranchNode(*m_visibleNodes[selectedItemIdx]) && !m_visibleNodes[selectedItemIdx]->expanded)
             {
                 m_visibleNodes[selectedItemIdx]->expanded = true;
-                markNodesDirty();
+                if (!m_visibleNodes[selectedItemIdx]->childrenLoaded)
+                    loadChildren(m_visibleNodes[selectedItemIdx].get());
+
+                showChildNodes(selectedItemIdx);
             }
             else if (selectedItemIdx + 1 < m_visibleNodes.size())
                 updateSelectedItem(m_selectedItem + 1);
@@ -1159,7 +1440,10 @@ namespace tgui
 
     bool TreeView::updateTime(Duration elapsedTime)
     {
-        const bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+
+        if (!m_backgroundLoads.empty() && finishBackgroundLoads())
+            screenRefreshRequired = true;
 
         if (m_animationTimeElapsed >= getDoubleClickTime())
         {
@@ -1214,14 +1498,7 @@ namespace tgui
             if (selectedNode == node.get())
                 m_selectedItem = static_cast<int>(pos);
 
-            const float iconPadding = (m_iconBounds.x / 4.f);
-            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
-            node->text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                    (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f)});
-
-            const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
-            if (right > m_maxRight)
-                m_maxRight = right;
+            positionNodeText(*node, textPadding);
 
             pos++;
             if (node->expanded && !node->nodes.empty())
@@ -1256,6 +1533,13 @@ namespace tgui
             updateSelectedAndHoveringItemColors();
         }
 
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbars()
+    {
         m_verticalScrollbar->setMaximum(static_cast<unsigned int>(m_itemHeight * m_visibleNodes.size()));
         m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxRight));
 
@@ -1359,7 +1643,7 @@ namespace tgui
             statesForIcon.transform.translate({std::round(iconOffset), std::round((i * m_itemHeight) + ((m_itemHeight - m_iconBounds.y) / 2.f))});
 
             // Draw an icon for the leaf node if a texture is set
-            if (m_visibleNodes[i]->nodes.empty())
+            if (!isBranchNode(*m_visibleNodes[i]))
             {
                 if (m_spriteLeaf.isSet())
                     target.drawSprite(statesForIcon, m_spriteLeaf);
@@ -1425,9 +1709,13 @@ namespace tgui
             }
         }
 
-        // Draw the texts
+        // Draw the texts. Their positions are relative to the row, so that rows can be inserted without moving the texts below.
         for (std::size_t i = firstNode; i < lastNode; ++i)
-            target.drawText(states, m_visibleNodes[i]->text);
+        {
+            auto statesForText = states;
+            statesForText.transform.translate({0, static_cast<float>(i * m_itemHeight)});
+            target.drawText(statesForText, m_visibleNodes[i]->text);
+        }
 
         target.removeClippingLayer();
 
@@ -1453,7 +1741,7 @@ namespace tgui
         else
             newNode->depth = 0;
 
-        nodes.push_back(std::move(newNode));
+        insertNode(nodes, parent ? parent->nodesByText : m_rootNodesByText, std::move(newNode));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1463,61 +1751,315 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
-        if (hierarchy.size() >= 2)
+        const auto node = findNode(m_rootNodesByText, hierarchy, 0);
+        if (!node)
+            return false;
+
+        expandOrCollapseNode(node.get(), expandNode);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::expandOrCollapseNode(Node* node, bool expandNode)
+    {
+        if (!expandNode)
         {
-            auto* node = findNode(m_nodes, hierarchy, 0);
-            if (!node)
-                return false;
+            if (!node->expanded)
+                return;
+
+            node->expanded = false;
+
+            // Nothing changes on the screen if the node was hidden inside a collapsed parent
+            const int index = findVisibleNodeIndex(node);
+            if (index >= 0)
+                hideChildNodes(static_cast<std::size_t>(index));
+
+            return;
+        }
+
+        // When expanding, also expand all parents
+        bool parentChanged = false;
+        for (auto* parent = node->parent; parent; parent = parent->parent)
+        {
+            if (parent->expanded)
+                continue;
+
+            parent->expanded = true;
+            parentChanged = true;
+            if (!parent->childrenLoaded)
+                loadChildren(parent);
+        }
+
+        const bool nodeChanged = !node->expanded;
+        if (nodeChanged)
+        {
+            node->expanded = true;
+            if (!node->childrenLoaded)
+                loadChildren(node);
+        }
+
+        if (parentChanged)
+            markNodesDirty();
+        else if (nodeChanged)
+        {
+            // All parents were already expanded, so the node is visible and only its own children have to be added
+            const int index = findVisibleNodeIndex(node);
+            if (index >= 0)
+                showChildNodes(static_cast<std::size_t>(index));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::selectVisibleNode(const Node* node)
+    {
+        const int index = findVisibleNodeIndex(node);
+        if (index < 0)
+            return false;
+
+        updateSelectedItem(index);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int TreeView::findVisibleNodeIndex(const Node* node) const
+    {
+        for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
+        {
+            if (m_visibleNodes[i].get() == node)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
 
-            bool nodeChanged = false;
-            if (expandNode)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::loadChildren(Node* node)
+    {
+        node->childrenLoaded = true;
+        if (!m_childLoader)
+            return;
+
+        std::vector<String> hierarchy = getNodeHierarchy(node);
+        if (!m_loadChildrenInBackground)
+        {
+            addLoadedChildren(node, m_childLoader(hierarchy));
+            return;
+        }
+
+        // If an earlier load failed then its placeholder is still shown and can be reused
+        const auto failedLoadIt = std::find_if(m_backgroundLoads.begin(), m_backgroundLoads.end(),
+            [node](const BackgroundLoad& load){ return !load.children.valid() && (load.node.lock().get() == node); });
+        if (failedLoadIt != m_backgroundLoads.end())
+        {
+            failedLoadIt->children = startBackgroundLoad(std::move(hierarchy));
+            return;
+        }
+
+        // The load only keeps a weak reference to the node, in case it gets removed before the children are loaded
+        const auto& siblings = node->parent ? node->parent->nodes : m_nodes;
+        TGUI_ASSERT((node->index < siblings.size()) && (siblings[node->index].get() == node), "Node must be part of the tree when loading its children");
+
+        // Show a placeholder item until the children are available
+        createNode(node->nodes, node, m_loadingItemText);
+
+        BackgroundLoad load;
+        load.node = siblings[node->index];
+        load.placeholder = node->nodes.back();
+        load.children = startBackgroundLoad(std::move(hierarchy));
+        m_backgroundLoads.push_back(std::move(load));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::future<std::vector<TreeView::LoadedChild>> TreeView::startBackgroundLoad(std::vector<String> hierarchy)
+    {
+        if (!m_childLoadWorker)
+            m_childLoadWorker = std::make_unique<ChildLoadWorker>();
+
+        return m_childLoadWorker->load(m_childLoader, std::move(hierarchy));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::addLoadedChildren(Node* node, const std::vector<LoadedChild>& children)
+    {
+        for (const auto& child : children)
+        {
+            createNode(node->nodes, node, child.text);
+            if (child.expandable)
             {
-                // When expanding, also expand all parents
-                auto* nodeToExpand = node;
-                while (nodeToExpand)
-                {
-                    if (nodeToExpand->expanded != expandNode)
-                    {
-                        nodeToExpand->expanded = expandNode;
-                        nodeChanged = true;
-                    }
+                node->nodes.back()->expanded = false;
+                node->nodes.back()->childrenLoaded = false;
+            }
+        }
+    }
 
-                    nodeToExpand = nodeToExpand->parent;
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::finishBackgroundLoads()
+    {
+        bool nodesChanged = false;
+        for (auto it = m_backgroundLoads.begin(); it != m_backgroundLoads.end();)
+        {
+            // A failed load is kept until its node is expanded again, or forgotten when the node no longer exists
+            if (!it->children.valid())
+            {
+                if (it->node.expired())
+                    it = m_backgroundLoads.erase(it);
+                else
+                    ++it;
+                continue;
             }
-            else // Collapsing
+
+            if (it->children.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
             {
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    nodeChanged = true;
-                }
+                ++it;
+                continue;
             }
 
+            const auto node = it->node.lock();
+            const auto placeholder = it->placeholder.lock();
 
-            if (nodeChanged)
-                markNodesDirty();
+            std::vector<LoadedChild> children;
+            try
+            {
+                children = it->children.get();
+            }
+            catch (...)
+            {
+                // Leave the node unloaded with its placeholder, so that expanding it again retries the load
+                if (node)
+                    node->childrenLoaded = false;
 
-            return true;
+                ++it;
+                continue;
+            }
+
+            it = m_backgroundLoads.erase(it);
+            if (!node)
+                continue;
+
+            if (placeholder)
+                eraseNode(node->nodes, node->nodesByText, placeholder.get());
+
+            addLoadedChildren(node.get(), children);
+
+            // Replace the placeholder on the screen with the loaded children
+            const int index = findVisibleNodeIndex(node.get());
+            if ((index >= 0) && node->expanded)
+            {
+                hideChildNodes(static_cast<std::size_t>(index));
+                showChildNodes(static_cast<std::size_t>(index));
+            }
+
+            nodesChanged = true;
         }
-        else // Root node
+
+        return nodesChanged;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::showChildNodes(std::size_t index)
+    {
+        std::vector<std::shared_ptr<Node>> childNodes;
+        collectVisibleNodes(m_visibleNodes[index]->nodes, childNodes, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached));
+        if (childNodes.empty())
+            return;
+
+        // The mouse stays at the same place, so it will be on top of a different node after the insertion
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        m_visibleNodes.insert(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index + 1), childNodes.begin(), childNodes.end());
+        if (m_selectedItem > static_cast<int>(index))
+            m_selectedItem += static_cast<int>(childNodes.size());
+
+        updateHoveredItem(oldHoveredItem);
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::hideChildNodes(std::size_t index)
+    {
+        const unsigned int depth = m_visibleNodes[index]->depth;
+        std::size_t end = index + 1;
+        while ((end < m_visibleNodes.size()) && (m_visibleNodes[end]->depth > depth))
+            ++end;
+
+        const std::size_t count = end - index - 1;
+        if (count == 0)
+            return;
+
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        if ((m_selectedItem > static_cast<int>(index)) && (m_selectedItem < static_cast<int>(end)))
+        {
+            // Like when the list is rebuilt, a selected node that gets hidden is no longer selected
+            m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->text.setColor(m_textColorCached);
+            m_selectedItem = -1;
+        }
+        else if (m_selectedItem >= static_cast<int>(end))
+            m_selectedItem -= static_cast<int>(count);
+
+        // The width only has to be recalculated when the widest text is being hidden
+        bool widestNodeHidden = false;
+        for (std::size_t i = index + 1; i < end; ++i)
         {
-            for (const auto& node : m_nodes)
+            const Text& text = m_visibleNodes[i]->text;
+            if (text.getPosition().x + text.getSize().x + m_paddingCached.getRight() >= m_maxRight)
             {
-                if (node->text.getString() != hierarchy.back())
-                    continue;
+                widestNodeHidden = true;
+                break;
+            }
+        }
 
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    markNodesDirty();
-                }
+        m_visibleNodes.erase(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index + 1), m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(end));
 
-                return true;
-            }
+        if (widestNodeHidden)
+        {
+            m_maxRight = 0;
+            for (const auto& node : m_visibleNodes)
+                m_maxRight = std::max(m_maxRight, node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight());
         }
 
-        return false;
+        if ((oldHoveredItem >= 0) && (static_cast<std::size_t>(oldHoveredItem) < m_visibleNodes.size()))
+            updateHoveredItem(oldHoveredItem);
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::collectVisibleNodes(const std::vector<std::shared_ptr<Node>>& nodes, std::vector<std::shared_ptr<Node>>& visibleNodes, float textPadding)
+    {
+        for (const auto& node : nodes)
+        {
+            visibleNodes.push_back(node);
+            positionNodeText(*node, textPadding);
+
+            if (node->expanded && !node->nodes.empty())
+                collectVisibleNodes(node->nodes, visibleNodes, textPadding);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::positionNodeText(Node& node, float textPadding)
+    {
+        const float iconPadding = (m_iconBounds.x / 4.f);
+        const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node.depth);
+        node.text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding, (m_itemHeight - node.text.getSize().y) / 2.f});
+
+        const float right = node.text.getPosition().x + node.text.getSize().x + m_paddingCached.getRight();
+        if (right > m_maxRight)
+            m_maxRight = right;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1608,26 +2150,24 @@ namespace tgui
 
     TreeView::Node* TreeView::findParentNode(const std::vector<String>& hierarchy, unsigned int parentIndex, std::vector<std::shared_ptr<Node>>& nodes, Node* parent, bool createParents)
     {
-        for (auto& node : nodes)
-        {
-            if (node->text.getString() != hierarchy[parentIndex])
-                continue;
-            else if (parentIndex + 2 == hierarchy.size())
-                return node.get();
-            else
-                return findParentNode(hierarchy, parentIndex + 1, node->nodes, node.get(), createParents);
-        }
+        const auto& nodesByText = parent ? parent->nodesByText : m_rootNodesByText;
 
-        if (createParents)
+        Node* node;
+        const auto it = nodesByText.find(hierarchy[parentIndex]);
+        if (it != nodesByText.end())
+            node = it->second.get();
+        else if (createParents)
         {
             createNode(nodes, parent, hierarchy[parentIndex]);
-            if (parentIndex + 2 == hierarchy.size())
-                return nodes.back().get();
-            else
-                return findParentNode(hierarchy, parentIndex + 1, nodes.back()->nodes, nodes.back().get(), createParents);
+            node = nodes.back().get();
         }
+        else
+            return nullptr;
 
-        return nullptr;
+        if (parentIndex + 2 == hierarchy.size())
+            return node;
+        else
+            return findParentNode(hierarchy, parentIndex + 1, node->nodes, node, createParents);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1638,6 +2178,73 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::ChildLoadWorker::ChildLoadWorker() :
+        m_thread{&ChildLoadWorker::run, this}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::ChildLoadWorker::~ChildLoadWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+
+        // Jobs that haven't started yet are dropped, only the loader that is currently running is waited for
+        m_jobAvailable.notify_one();
+        m_thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::future<std::vector<TreeView::LoadedChild>> TreeView::ChildLoadWorker::load(ChildLoader loader, std::vector<String> hierarchy)
+    {
+        Job job;
+        job.loader = std::move(loader);
+        job.hierarchy = std::move(hierarchy);
+        auto future = job.promise.get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(std::move(job));
+        }
+
+        m_jobAvailable.notify_one();
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::ChildLoadWorker::run()
+    {
+        while (true)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_jobAvailable.wait(lock, [this]{ return m_stopping || !m_jobs.empty(); });
+                if (m_stopping)
+                    return;
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            try
+            {
+                job.promise.set_value(job.loader(job.hierarchy));
+            }
+            catch (...)
+            {
+                job.promise.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+#include <thread>
+
+TEST_CASE("[BackendGui]")
+{
+    tgui::BackendGui& gui = *globalGui;
+
+    SECTION("post")
+    {
+        std::vector<int> calls;
+
+        SECTION("Functions are called in order during updateTime")
+        {
+            gui.post([&]{ calls.push_back(1); });
+            gui.post([&]{ calls.push_back(2); });
+            REQUIRE(calls.empty());
+
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(calls == std::vector<int>{1, 2});
+
+            gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(calls == std::vector<int>{1, 2});
+        }
+
+        SECTION("Coalescing")
+        {
+            gui.post([&]{ calls.push_back(1); }, 5);
+            gui.post([&]{ calls.push_back(2); });
+            gui.post([&]{ calls.push_back(3); }, 5);
+            gui.post([&]{ calls.push_back(4); }, 6);
+            gui.post([&]{ calls.push_back(5); }, 5);
+
+            gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(calls == std::vector<int>{2, 4, 5});
+        }
+
+        SECTION("Posting while calling posted functions")
+        {
+            gui.post([&]{
+                calls.push_back(1);
+                gui.post([&]{ calls.push_back(2); });
+            });
+
+            gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(calls == std::vector<int>{1});
+
+            gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(calls == std::vector<int>{1, 2});
+        }
+
+        SECTION("Exception in posted function")
+        {
+            gui.post([&]{ calls.push_back(1); });
+            gui.post([&]{ throw tgui::Exception{U"Posted function failed"}; });
+            gui.post([&]{ calls.push_back(2); });
+
+            REQUIRE_THROWS_AS(gui.updateTime(std::chrono::milliseconds(1)), tgui::Exception);
+            REQUIRE(calls == std::vector<int>{1, 2});
+
+            gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(calls == std::vector<int>{1, 2});
+        }
+
+        SECTION("Other threads")
+        {
+            unsigned int count = 0;
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                threads.emplace_back([&gui, &count]{
+                    for (unsigned int j = 0; j < 1000; ++j)
+                        gui.post([&count]{ ++count; });
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(count == 4000);
+        }
+    }
+
+    SECTION("Mouse move coalescing")
+    {
+        gui.setAbsoluteViewport({0, 0, 400, 300});
+        gui.setAbsoluteView({0, 0, 400, 300});
+
+        auto button = tgui::Button::create();
+        button->setPosition(10, 10);
+        button->setSize(100, 50);
+        gui.add(button);
+
+        unsigned int mouseEnterCount = 0;
+        button->onMouseEnter([&]{ ++mouseEnterCount; });
+
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+
+        REQUIRE(!gui.isMouseMoveCoalescingEnabled());
+        gui.setMouseMoveCoalescingEnabled(true);
+        REQUIRE(gui.isMouseMoveCoalescingEnabled());
+
+        SECTION("Dispatched when processed")
+        {
+            event.mouseMove = {200, 200};
+            gui.handleEvent(event);
+            event.mouseMove = {50, 30};
+            gui.handleEvent(event);
+            event.mouseMove = {60, 30};
+            gui.handleEvent(event);
+            REQUIRE(mouseEnterCount == 0);
+            REQUIRE(!button->isMouseDown());
+
+            gui.processCoalescedMouseMoves();
+            REQUIRE(mouseEnterCount == 1);
+            REQUIRE(gui.getCoalescedMousePositions() == std::vector<tgui::Vector2f>{
+                gui.mapPixelToCoords({200, 200}), gui.mapPixelToCoords({50, 30}), gui.mapPixelToCoords({60, 30})});
+
+            REQUIRE(!gui.processCoalescedMouseMoves());
+        }
+
+        SECTION("Dispatched before other events")
+        {
+            event.mouseMove = {50, 30};
+            gui.handleEvent(event);
+            REQUIRE(mouseEnterCount == 0);
+
+            tgui::Event pressEvent;
+            pressEvent.type = tgui::Event::Type::MouseButtonPressed;
+            pressEvent.mouseButton = {tgui::Event::MouseButton::Left, 50, 30};
+            gui.handleEvent(pressEvent);
+            REQUIRE(mouseEnterCount == 1);
+            REQUIRE(button->isMouseDown());
+            REQUIRE(gui.getCoalescedMousePositions().size() == 1);
+
+            pressEvent.type = tgui::Event::Type::MouseButtonReleased;
+            gui.handleEvent(pressEvent);
+        }
+
+        SECTION("Dispatched when updating time")
+        {
+            event.mouseMove = {50, 30};
+            gui.handleEvent(event);
+            REQUIRE(gui.updateTime());
+            REQUIRE(mouseEnterCount == 1);
+        }
+
+        SECTION("Disabled")
+        {
+            event.mouseMove = {50, 30};
+            gui.handleEvent(event);
+            gui.setMouseMoveCoalescingEnabled(false);
+            REQUIRE(mouseEnterCount == 1);
+
+            event.mouseMove = {200, 200};
+            gui.handleEvent(event);
+            REQUIRE(gui.getCoalescedMousePositions() == std::vector<tgui::Vector2f>{gui.mapPixelToCoords({200, 200})});
+        }
+
+        gui.setMouseMoveCoalescingEnabled(false);
+        gui.removeAllWidgets();
+        gui.setRelativeViewport({0, 0, 1, 1});
+        gui.setRelativeView({0, 0, 1, 1});
+    }
+}
@@ -0,0 +1,144 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+namespace
+{
+    struct ShapeRenderTarget : public tgui::BackendRenderTarget
+    {
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override {}
+        void drawGui(const std::shared_ptr<tgui::RootContainer>&) override {}
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+
+        void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex* vertices, std::size_t vertexCount,
+                             const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<tgui::BackendTexture>&) override
+        {
+            ++drawCalls;
+            lastVertices = vertices;
+            lastVertexCount = vertexCount;
+            lastIndexCount = indexCount;
+
+            for (std::size_t i = 0; i < indexCount; ++i)
+                REQUIRE(indices[i] < vertexCount);
+        }
+
+        static std::vector<tgui::Vector2f> getUnitCircle(unsigned int nrPoints)
+        {
+            return getUnitCirclePoints(nrPoints);
+        }
+
+        std::size_t getCachedShapeCount() const
+        {
+            return m_shapeGeometryCache.size();
+        }
+
+        unsigned int drawCalls = 0;
+        const tgui::Vertex* lastVertices = nullptr;
+        std::size_t lastVertexCount = 0;
+        std::size_t lastIndexCount = 0;
+    };
+}
+
+TEST_CASE("[BackendRenderTarget]")
+{
+    ShapeRenderTarget target;
+    target.setView({0, 0, 400, 300}, {0, 0, 400, 300}, {400, 300});
+
+    SECTION("Unit circle")
+    {
+        const auto points = target.getUnitCircle(4);
+        REQUIRE(points.size() == 4);
+        REQUIRE(points[0].x == Approx(1));
+        REQUIRE(points[0].y == Approx(0).margin(0.0001));
+        REQUIRE(points[1].x == Approx(0).margin(0.0001));
+        REQUIRE(points[1].y == Approx(1));
+        REQUIRE(points[2].x == Approx(-1));
+        REQUIRE(target.getUnitCircle(8).size() == 8);
+    }
+
+    SECTION("Circle geometry is reused")
+    {
+        target.drawCircle({}, 20, tgui::Color::Red, 2, tgui::Color::Blue);
+        REQUIRE(target.drawCalls == 1); // Border and background are drawn together
+        const tgui::Vertex* vertices = target.lastVertices;
+        const std::size_t vertexCount = target.lastVertexCount;
+        const std::size_t indexCount = target.lastIndexCount;
+
+        target.drawCircle({}, 20, tgui::Color::Red, 2, tgui::Color::Blue);
+        REQUIRE(target.drawCalls == 2);
+        REQUIRE(target.lastVertices == vertices);
+        REQUIRE(target.lastVertexCount == vertexCount);
+        REQUIRE(target.lastIndexCount == indexCount);
+
+        // Changing the color creates new geometry
+        target.drawCircle({}, 20, tgui::Color::Green, 2, tgui::Color::Blue);
+        REQUIRE(target.lastVertices != vertices);
+        REQUIRE(target.lastVertices[0].color.blue == 255);
+        REQUIRE(target.lastVertices[target.lastVertexCount - 1].color.green == 255);
+    }
+
+    SECTION("Least recently used geometry is removed from the cache")
+    {
+        target.drawCircle({}, 20, tgui::Color::Red, 2, tgui::Color::Blue);
+        const tgui::Vertex* vertices = target.lastVertices;
+
+        // The circle that is drawn in between the other shapes is never removed
+        for (unsigned int i = 0; i < 300; ++i)
+        {
+            target.drawRoundedRectangle({}, {100, static_cast<float>(50 + i)}, tgui::Color::Red, 5, {1}, tgui::Color::Blue);
+            REQUIRE(target.getCachedShapeCount() <= 256);
+
+            target.drawCircle({}, 20, tgui::Color::Red, 2, tgui::Color::Blue);
+            REQUIRE(target.lastVertices == vertices);
+        }
+
+        REQUIRE(target.getCachedShapeCount() == 256);
+    }
+
+    SECTION("Rounded rectangle geometry is reused")
+    {
+        target.drawRoundedRectangle({}, {100, 50}, tgui::Color::Red, 5, {1}, tgui::Color::Blue);
+        REQUIRE(target.drawCalls == 1);
+        const tgui::Vertex* vertices = target.lastVertices;
+
+        target.drawRoundedRectangle({}, {100, 50}, tgui::Color::Red, 5, {1}, tgui::Color::Blue);
+        REQUIRE(target.lastVertices == vertices);
+
+        target.drawRoundedRectangle({}, {100, 60}, tgui::Color::Red, 5, {1}, tgui::Color::Blue);
+        REQUIRE(target.lastVertices != vertices);
+
+        // A radius that is too small to have rounded corners results in a rectangle
+        target.drawRoundedRectangle({}, {100, 50}, tgui::Color::Red, 0.4f, {0}, tgui::Color::Blue);
+        REQUIRE(target.lastVertexCount == 5);
+        REQUIRE(target.lastIndexCount == 12);
+        for (std::size_t i = 0; i < target.lastVertexCount; ++i)
+        {
+            REQUIRE(!std::isnan(target.lastVertices[i].position.x));
+            REQUIRE(!std::isnan(target.lastVertices[i].position.y));
+        }
+    }
+}
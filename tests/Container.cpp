@@ -437,5 +437,168 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}) == w3);
     }
 
+    SECTION("Cached as layer")
+    {
+        struct LayerRenderTarget : public tgui::BackendRenderTarget
+        {
+            void setClearColor(const tgui::Color&) override {}
+            void clearScreen() override {}
+            void drawGui(const std::shared_ptr<tgui::RootContainer>&) override {}
+            void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+
+            void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex*, std::size_t, const unsigned int*, std::size_t,
+                                 const std::shared_ptr<tgui::BackendTexture>&) override
+            {
+                ++drawCalls;
+            }
+
+            bool beginLayer(const tgui::RenderStates& states, std::shared_ptr<tgui::BackendTexture>& layerTexture, tgui::Vector2f size) override
+            {
+                if (!layersSupported)
+                    return false;
+
+                if (!layerTexture)
+                    layerTexture = std::make_shared<tgui::BackendTexture>();
+
+                layerTexture->loadTextureOnly(getLayerPixelSize(states, size), nullptr, false);
+
+                layerSize = size;
+                ++layersRendered;
+                return true;
+            }
+
+            void endLayer() override
+            {
+            }
+
+            void drawLayer(const tgui::RenderStates&, const std::shared_ptr<tgui::BackendTexture>&, tgui::Vector2f) override
+            {
+                ++layersDrawn;
+            }
+
+            bool layersSupported = true;
+            tgui::Vector2f layerSize;
+            unsigned int layersRendered = 0;
+            unsigned int layersDrawn = 0;
+            unsigned int drawCalls = 0;
+        };
+
+        LayerRenderTarget target;
+        target.setView({0, 0, 400, 300}, {0, 0, 400, 300}, {400, 300});
+
+        auto panel = tgui::Panel::create({200, 100});
+        auto button = tgui::Button::create("Button");
+        auto label = tgui::Label::create("Label");
+        panel->add(button);
+        panel->add(label);
+
+        REQUIRE(!panel->isCachedAsLayer());
+        panel->setCachedAsLayer(true);
+        REQUIRE(panel->isCachedAsLayer());
+
+        target.drawWidget({}, panel);
+        REQUIRE(target.layersRendered == 1);
+        REQUIRE(target.layersDrawn == 1);
+        REQUIRE(target.layerSize == panel->getInnerSize());
+
+        // Drawing again reuses the layer and doesn't draw the child widgets
+        const unsigned int drawCallsFirstFrame = target.drawCalls;
+        target.drawWidget({}, panel);
+        REQUIRE(target.layersRendered == 1);
+        REQUIRE(target.layersDrawn == 2);
+        REQUIRE(target.drawCalls - drawCallsFirstFrame < drawCallsFirstFrame);
+
+        SECTION("Changes to children invalidate the layer")
+        {
+            button->setPosition(10, 20);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 2);
+
+            button->getRenderer()->setTextColor(tgui::Color::Red);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 3);
+
+            panel->remove(button);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 4);
+
+            // The size of the label changes with its text
+            label->setText("Longer text");
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 5);
+
+            label->setVisible(false);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 6);
+
+            label->setTextSize(20);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 7);
+
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 7);
+
+            // Content changes outside of event handling that don't affect the widget size require calling invalidateLayer
+            label->setAutoSize(false);
+            label->setText("Text");
+            panel->invalidateLayer();
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 8);
+        }
+
+        SECTION("Scaled layer")
+        {
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 1);
+
+            // The texture is sized for the scaling of the panel, so it has to be rendered again when the scale changes
+            tgui::RenderStates states;
+            states.transform.scale({2, 2});
+            target.drawWidget(states, panel);
+            REQUIRE(target.layersRendered == 2);
+
+            target.drawWidget(states, panel);
+            REQUIRE(target.layersRendered == 2);
+        }
+
+        SECTION("Nested layers")
+        {
+            auto innerPanel = tgui::Panel::create({50, 50});
+            innerPanel->setCachedAsLayer(true);
+            panel->add(innerPanel);
+
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 3);
+
+            auto innerButton = tgui::Button::create();
+            innerPanel->add(innerButton);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 5);
+
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 5);
+        }
+
+        SECTION("Render target without layer support")
+        {
+            target.layersSupported = false;
+            panel->invalidateLayer();
+
+            const unsigned int drawCallsBefore = target.drawCalls;
+            const unsigned int layersDrawnBefore = target.layersDrawn;
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersDrawn == layersDrawnBefore);
+            REQUIRE(target.drawCalls - drawCallsBefore == drawCallsFirstFrame);
+        }
+
+        SECTION("Disabling the cache")
+        {
+            panel->setCachedAsLayer(false);
+            target.drawWidget({}, panel);
+            REQUIRE(target.layersRendered == 1);
+            REQUIRE(target.layersDrawn == 2);
+        }
+    }
+
     // TODO: Events
 }
@@ -24,6 +24,18 @@
 
 #include "Tests.hpp"
 
+#include <thread>
+#include <fstream>
+#include <cstdio>
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+#endif
+
+#ifdef TGUI_SYSTEM_WINDOWS
+    #include <direct.h>
+#endif
+
 TEST_CASE("[Font]")
 {
     REQUIRE(tgui::Font() == nullptr);
@@ -31,4 +43,148 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf") != nullptr);
 
     REQUIRE_THROWS_AS(tgui::Font("NonExistentFile.ttf"), tgui::Exception);
+
+    SECTION("DistanceField")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        REQUIRE(!font.isDistanceFieldEnabled());
+
+        font.setDistanceFieldEnabled(true);
+
+        // Not every font backend supports distance fields
+        if (font.isDistanceFieldEnabled())
+        {
+            // All character sizes share the same glyph in the texture
+            const tgui::FontGlyph glyph20 = font.getGlyph(U'A', 20, false);
+            const tgui::FontGlyph glyph40 = font.getGlyph(U'A', 40, false);
+            const tgui::FontGlyph glyphOutline = font.getGlyph(U'A', 40, false, 2);
+            REQUIRE(glyph20.textureRect == glyph40.textureRect);
+            REQUIRE(glyphOutline.textureRect == glyph40.textureRect);
+
+            REQUIRE(glyph40.advance == Approx(2 * glyph20.advance));
+            REQUIRE(glyph40.bounds.width == Approx(2 * glyph20.bounds.width));
+            REQUIRE(glyph40.bounds.height == Approx(2 * glyph20.bounds.height));
+
+            auto label = tgui::Label::create("Distance field");
+            label->getRenderer()->setFont(font);
+            label->setTextSize(40);
+            label->getRenderer()->setTextOutlineThickness(2);
+            REQUIRE(label->getSize().x > 0);
+
+            // Outlines can't extend further than the distances stored around the glyphs
+            REQUIRE(tgui::BackendFont::getDistanceFieldMaxOutlineThickness(40) == Approx(5));
+
+            font.setDistanceFieldEnabled(false);
+            REQUIRE(!font.isDistanceFieldEnabled());
+            REQUIRE(font.getGlyph(U'A', 20, false).textureRect != glyph20.textureRect);
+        }
+    }
+
+    SECTION("Preload")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents);
+
+        const auto waitForPreload = [](const tgui::Font& font){
+            for (unsigned int i = 0; (i < 1000) && font.isPreloading(); ++i)
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            REQUIRE(!font.isPreloading());
+        };
+
+        // Preloaded glyphs are identical to glyphs that are loaded when they are first needed
+        const auto compareGlyphs = [](tgui::Font& font1, tgui::Font& font2, float advanceOffset){
+            for (const char32_t codePoint : std::u32string(U"Preload"))
+            {
+                const tgui::FontGlyph glyph1 = font1.getGlyph(codePoint, 25, true);
+                const tgui::FontGlyph glyph2 = font2.getGlyph(codePoint, 25, true);
+                REQUIRE(glyph1.advance == glyph2.advance + advanceOffset);
+                REQUIRE(glyph1.bounds == glyph2.bounds);
+                REQUIRE(glyph1.textureRect.getSize() == glyph2.textureRect.getSize());
+            }
+        };
+
+        // The preloaded glyphs are all added to the texture at once, none of them have to be rasterized when they are used
+        const auto checkGlyphsPreloaded = [](tgui::Font& font){
+            (void)font.getGlyph(U'P', 25, true);
+
+            unsigned int textureVersion = 0;
+            (void)font.getBackendFont()->getTexture(25, textureVersion);
+            for (const char32_t codePoint : std::u32string(U"Preload"))
+                (void)font.getGlyph(codePoint, 25, true);
+
+            unsigned int newTextureVersion = 0;
+            (void)font.getBackendFont()->getTexture(25, newTextureVersion);
+            REQUIRE(newTextureVersion == textureVersion);
+        };
+
+        tgui::Font referenceFont(fileContents.get(), fileSize);
+
+        tgui::Font font(fileContents.get(), fileSize);
+        REQUIRE(font.getGlyphCacheDirectory() == "");
+        font.setGlyphCacheDirectory("GlyphCache");
+        REQUIRE(font.getGlyphCacheDirectory() == "GlyphCache");
+        tgui::Filesystem::createDirectory(tgui::Filesystem::Path("GlyphCache"));
+
+        font.preload(U"Preload", {25}, tgui::TextStyle::Bold);
+        waitForPreload(font);
+        checkGlyphsPreloaded(font);
+        compareGlyphs(font, referenceFont, 0);
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+        // Only the FreeType backend preloads in the background and uses the cache directory, other backends load immediately
+        if (std::dynamic_pointer_cast<tgui::BackendFontFreetype>(font.getBackendFont()))
+        {
+            const auto cacheFiles = tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("GlyphCache"));
+            REQUIRE(cacheFiles.size() == 1);
+            REQUIRE(cacheFiles[0].filename.starts_with(U"tgui-glyphs-"));
+
+            // Change the advance of each glyph in the cache file, to find out whether the glyphs are read from it.
+            // The file contains a header with the glyph count, followed by the key, metrics, image info and image of each glyph.
+            const tgui::Filesystem::Path cacheFilename = tgui::Filesystem::Path("GlyphCache") / cacheFiles[0].filename;
+            std::fstream cacheFile(cacheFilename.asNativeString(), std::ios::in | std::ios::out | std::ios::binary);
+            REQUIRE(cacheFile);
+
+            std::uint32_t header[3];
+            REQUIRE(cacheFile.read(reinterpret_cast<char*>(header), sizeof(header)));
+            REQUIRE(header[2] == 7);
+            for (std::uint32_t i = 0; i < header[2]; ++i)
+            {
+                const std::streamoff advancePos = static_cast<std::streamoff>(cacheFile.tellg()) + sizeof(std::uint64_t);
+                float metrics[7];
+                std::uint32_t imageInfo[3];
+                REQUIRE(cacheFile.seekg(advancePos));
+                REQUIRE(cacheFile.read(reinterpret_cast<char*>(metrics), sizeof(metrics)));
+                REQUIRE(cacheFile.read(reinterpret_cast<char*>(imageInfo), sizeof(imageInfo)));
+                const std::streamoff nextGlyphPos = static_cast<std::streamoff>(cacheFile.tellg()) + (imageInfo[0] * imageInfo[1]);
+
+                metrics[0] += 100;
+                REQUIRE(cacheFile.seekp(advancePos));
+                REQUIRE(cacheFile.write(reinterpret_cast<const char*>(&metrics[0]), sizeof(float)));
+                REQUIRE(cacheFile.seekg(nextGlyphPos));
+            }
+            cacheFile.close();
+
+            // The same glyphs are found in the cache file by another font with the same contents
+            tgui::Font cachedFont(fileContents.get(), fileSize);
+            cachedFont.setGlyphCacheDirectory("GlyphCache");
+            cachedFont.preload(U"Preload", {25}, tgui::TextStyle::Bold);
+            waitForPreload(cachedFont);
+            checkGlyphsPreloaded(cachedFont);
+            compareGlyphs(cachedFont, referenceFont, 100);
+
+            // The space wasn't preloaded and is loaded normally
+            REQUIRE(cachedFont.getGlyph(U' ', 25, true).advance == referenceFont.getGlyph(U' ', 25, true).advance);
+        }
+#endif
+
+        for (const auto& file : tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("GlyphCache")))
+            REQUIRE(std::remove((tgui::Filesystem::Path("GlyphCache") / file.filename).asString().toStdString().c_str()) == 0);
+
+#ifdef TGUI_SYSTEM_WINDOWS
+        REQUIRE(_rmdir("GlyphCache") == 0);
+#else
+        REQUIRE(std::remove("GlyphCache") == 0);
+#endif
+    }
 }
@@ -109,6 +109,24 @@ TEST_CASE("[DataIO]")
             REQUIRE_NOTHROW(tgui::DataIO::parse(input));
         }
 
+        SECTION("Parsing directly from memory")
+        {
+            const std::string input = "Section1 { Property = Value /* comment */ with  spaces; } // comment\nSection2 { List = [\"a, b\", c]; }";
+
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(tgui::CharStringView{input}));
+            REQUIRE(rootNode->children.size() == 2);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->value == "Value with spaces");
+            REQUIRE(rootNode->children[1]->propertyValuePairs["List"]->valueList.size() == 2);
+            REQUIRE(rootNode->children[1]->propertyValuePairs["List"]->valueList[0] == "\"a, b\"");
+            REQUIRE(rootNode->children[1]->propertyValuePairs["List"]->valueList[1] == "c");
+
+            // Only the part of the stream that wasn't read yet is parsed
+            std::stringstream stream(input);
+            stream.seekg(static_cast<std::streamoff>(input.find("Section2")));
+            REQUIRE(tgui::DataIO::parse(stream)->children.size() == 1);
+        }
+
         SECTION("Unexpected '/' found")
         {
             std::stringstream input("/ {}");
@@ -228,6 +246,56 @@ TEST_CASE("[DataIO]")
         }
     }
 
+    SECTION("parseBinary")
+    {
+        std::stringstream textStream{"Section { Key = \"Välue\"; List = [1, 2]; }"};
+        std::stringstream binaryStream;
+        tgui::DataIO::emitBinary(tgui::DataIO::parse(textStream), binaryStream);
+        const std::string binaryData = binaryStream.str();
+        const auto* data = reinterpret_cast<const std::uint8_t*>(binaryData.data());
+
+        SECTION("Valid input")
+        {
+            auto root = tgui::DataIO::parseBinary(data, binaryData.size());
+            REQUIRE(root->children.size() == 1);
+            REQUIRE(root->children[0]->parent == root.get());
+            REQUIRE(root->children[0]->propertyValuePairs["Key"]->value == U"\"Välue\"");
+            REQUIRE(root->children[0]->propertyValuePairs["List"]->listNode);
+            REQUIRE(root->children[0]->propertyValuePairs["List"]->valueList.size() == 2);
+        }
+
+        SECTION("Text input")
+        {
+            const std::string text = "Key = Value;";
+            REQUIRE(!tgui::DataIO::isBinary(reinterpret_cast<const std::uint8_t*>(text.data()), text.size()));
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(reinterpret_cast<const std::uint8_t*>(text.data()), text.size()), tgui::Exception);
+        }
+
+        SECTION("Truncated input")
+        {
+            for (std::size_t size = 0; size < binaryData.size(); ++size)
+                REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(data, size), tgui::Exception);
+        }
+
+        SECTION("Unsupported version")
+        {
+            std::string modifiedData = binaryData;
+            modifiedData[8] = 2;
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(reinterpret_cast<const std::uint8_t*>(modifiedData.data()), modifiedData.size()), tgui::Exception);
+        }
+
+        SECTION("Number too large")
+        {
+            // One string of length 1 followed by an empty root node
+            std::string validData = binaryData.substr(0, 9) + '\x01' + '\x01' + 'A' + std::string(3, '\x00');
+            REQUIRE_NOTHROW(tgui::DataIO::parseBinary(reinterpret_cast<const std::uint8_t*>(validData.data()), validData.size()));
+
+            // Same data, but the length is encoded with a bit that doesn't fit in 64 bits
+            std::string modifiedData = binaryData.substr(0, 9) + '\x01' + '\x81' + std::string(8, '\x80') + '\x02' + 'A' + std::string(3, '\x00');
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(reinterpret_cast<const std::uint8_t*>(modifiedData.data()), modifiedData.size()), tgui::Exception);
+        }
+    }
+
     SECTION("correct input")
     {
         std::stringstream stream;
@@ -279,6 +347,25 @@ TEST_CASE("[DataIO]")
             stream << "}" << std::endl;
         }
 
+        SECTION("binary")
+        {
+            std::stringstream textStream;
+            textStream << "GlobalProperty1 = GlobalValue1;" << std::endl;
+            textStream << "GlobalProperty2 = GlobalValue2;" << std::endl;
+            textStream << "Child1 { Property = Value; NestedChild { PropertyA = ValueA; PropertyB = []; PropertyC = [X, Y, Z]; } }" << std::endl;
+            textStream << "{}" << std::endl;
+
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(tgui::DataIO::parse(textStream), binaryStream);
+
+            const std::string binaryData = binaryStream.str();
+            const auto* data = reinterpret_cast<const std::uint8_t*>(binaryData.data());
+            REQUIRE(tgui::DataIO::isBinary(data, binaryData.size()));
+
+            // Convert the tree back to text so that the checks below are performed on the result of parseBinary
+            tgui::DataIO::emit(tgui::DataIO::parseBinary(data, binaryData.size()), stream);
+        }
+
         // Check that emit function works correctly by parsing the result and check if it equals the input
         auto parsedRoot = tgui::DataIO::parse(stream);
         REQUIRE(parsedRoot->name == ""); // Root node name is ignored when saving
@@ -141,6 +141,33 @@ TEST_CASE("[Theme]")
                 label1->getRenderer()->setTextColor("yellow");
                 REQUIRE(label2->getRenderer()->getTextColor() != tgui::Color::Yellow);
             }
+
+            SECTION("Data is only copied when changed")
+            {
+                auto label1 = tgui::Label::create();
+                auto label2 = tgui::Label::create();
+                label1->setRenderer(theme.getRenderer("Label"));
+                label2->setRenderer(theme.getRenderer("Label"));
+
+                // Reading from the renderer doesn't copy the data
+                const tgui::Color themeColor = label1->getRenderer()->getTextColor();
+                REQUIRE(label1->getSharedRenderer()->getData() == theme.getRenderer("Label"));
+
+                label1->getRenderer()->setTextColor("red");
+                REQUIRE(label1->getSharedRenderer()->getData() != theme.getRenderer("Label"));
+                REQUIRE(label1->getSharedRenderer()->getTextColor() == tgui::Color::Red);
+                REQUIRE(label2->getSharedRenderer()->getData() == theme.getRenderer("Label"));
+                REQUIRE(label2->getSharedRenderer()->getTextColor() == themeColor);
+
+                // Changing the shared data doesn't affect a widget that requested its own renderer
+                auto label3 = tgui::Label::create();
+                label3->setRenderer(theme.getRenderer("Label"));
+                (void)label3->getRenderer();
+                label2->getSharedRenderer()->setTextColor("green");
+                REQUIRE(label2->getSharedRenderer()->getTextColor() == tgui::Color::Green);
+                REQUIRE(label3->getSharedRenderer()->getTextColor() == themeColor);
+                REQUIRE(label3->getSharedRenderer()->getData() != theme.getRenderer("Label"));
+            }
         }
 
         SECTION("Without widgets")
@@ -158,4 +158,87 @@ TEST_CASE("[Signal]")
         widget->setPosition(20, 20);
         REQUIRE(i == 1);
     }
+
+    SECTION("Changing handlers during emit")
+    {
+        std::vector<int> calls;
+
+        SECTION("Disconnect itself")
+        {
+            unsigned int id = 0;
+            id = widget->onPositionChange([&]{ calls.push_back(1); widget->onPositionChange.disconnect(id); });
+            widget->onPositionChange([&]{ calls.push_back(2); });
+
+            widget->setPosition(10, 10);
+            widget->setPosition(20, 20);
+            REQUIRE(calls == std::vector<int>{1, 2, 2});
+        }
+
+        SECTION("Disconnect other handler")
+        {
+            unsigned int id = 0;
+            widget->onPositionChange([&]{ calls.push_back(widget->onPositionChange.disconnect(id) ? 1 : 0); });
+            id = widget->onPositionChange([&]{ calls.push_back(2); });
+
+            widget->setPosition(10, 10);
+            widget->setPosition(20, 20);
+            REQUIRE(calls == std::vector<int>{1, 0});
+        }
+
+        SECTION("Disconnect all")
+        {
+            widget->onPositionChange([&]{ calls.push_back(1); widget->onPositionChange.disconnectAll(); });
+            widget->onPositionChange([&]{ calls.push_back(2); });
+
+            widget->setPosition(10, 10);
+            widget->setPosition(20, 20);
+            REQUIRE(calls == std::vector<int>{1});
+        }
+
+        SECTION("Connect")
+        {
+            widget->onPositionChange([&]{
+                calls.push_back(1);
+                if (calls.size() == 1)
+                    widget->onPositionChange([&]{ calls.push_back(2); });
+            });
+
+            widget->setPosition(10, 10);
+            REQUIRE(calls == std::vector<int>{1});
+
+            widget->setPosition(20, 20);
+            REQUIRE(calls == std::vector<int>{1, 1, 2});
+        }
+
+        SECTION("Nested emit")
+        {
+            tgui::Vector2f innerPos;
+            tgui::Vector2f outerPos;
+            widget->onPositionChange([&](tgui::Vector2f pos){
+                if (pos.x < 15)
+                {
+                    widget->setPosition(20, 20);
+                    outerPos = pos;
+                }
+                else
+                    innerPos = pos;
+            });
+
+            widget->setPosition(10, 10);
+            REQUIRE(outerPos == tgui::Vector2f{10, 10});
+            REQUIRE(innerPos == tgui::Vector2f{20, 20});
+        }
+
+        SECTION("Destroy widget")
+        {
+            auto button = tgui::Button::create();
+            std::weak_ptr<tgui::Button> weakButton = button;
+            button->onPress([&]{ calls.push_back(1); button = nullptr; });
+            button->onPress([&]{ calls.push_back(2); });
+
+            button->onPress.emit(button.get(), "Text");
+            REQUIRE(weakButton.expired());
+            REQUIRE(calls == std::vector<int>{1});
+        }
+    }
 }
@@ -29,8 +29,13 @@
 
 #include "Tests.hpp"
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/TextureManager.hpp>
+    #include <TGUI/Loading/ImageLoader.hpp>
 #endif
 
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
@@ -120,6 +125,57 @@ TEST_CASE("[Texture]")
             }
         }
 
+        SECTION("Preloaded images")
+        {
+            tgui::ImageLoader::preloadFiles({"resources/image.png", "resources/image.jpg", "NonExistent.png"});
+
+            tgui::Vector2u imageSize;
+            REQUIRE(tgui::ImageLoader::loadFromFile("resources/image.jpg", imageSize) != nullptr);
+            REQUIRE(imageSize == tgui::Vector2u(50, 50));
+
+            // A preloaded image is only returned once, loading it again reads the file
+            REQUIRE(tgui::ImageLoader::loadFromFile("resources/image.jpg", imageSize) != nullptr);
+            REQUIRE(tgui::ImageLoader::loadFromFile("NonExistent.png", imageSize) == nullptr);
+
+            tgui::Texture texture{"resources/image.png"};
+            REQUIRE(texture.getImageSize() == tgui::Vector2u(50, 50));
+            REQUIRE(tgui::TextureManager::isImageCached("resources/image.png"));
+
+            tgui::ImageLoader::releasePreloadedFiles({"resources/image.png", "resources/image.jpg", "NonExistent.png"});
+        }
+
+        SECTION("Nested preloads")
+        {
+            // The copy of the image is placed in the temp directory and is removed at the end of the test, even when it fails
+#ifdef TGUI_SYSTEM_WINDOWS
+            const char* tempDir = std::getenv("TEMP");
+#else
+            const char* tempDir = std::getenv("TMPDIR");
+#endif
+            const tgui::String filename = (tgui::Filesystem::Path(tempDir ? tempDir : "/tmp") / "tgui-PreloadedImage.png").asString();
+            struct RemoveFileOnExit
+            {
+                ~RemoveFileOnExit() { std::remove(path.c_str()); }
+                std::string path;
+            } removeFileOnExit{filename.toStdString()};
+
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory("resources/image.png", fileSize);
+            REQUIRE(std::ofstream(filename.toStdString(), std::ios::binary).write(reinterpret_cast<const char*>(fileContents.get()), static_cast<std::streamsize>(fileSize)));
+
+            // A second batch doesn't discard the images of the first one, and releasing it keeps the images the first one needs
+            tgui::ImageLoader::preloadFiles({filename});
+            tgui::ImageLoader::preloadFiles({filename, "resources/image.jpg"});
+            tgui::ImageLoader::releasePreloadedFiles({filename, "resources/image.jpg"});
+
+            // The image can only be loaded after the file is removed when it is still preloaded
+            REQUIRE(std::remove(filename.toStdString().c_str()) == 0);
+            tgui::Vector2u imageSize;
+            REQUIRE(tgui::ImageLoader::loadFromFile(filename, imageSize) != nullptr);
+            REQUIRE(tgui::ImageLoader::loadFromFile(filename, imageSize) == nullptr);
+            tgui::ImageLoader::releasePreloadedFiles({filename});
+        }
+
         SECTION("loadFromBase64")
         {
             tgui::Texture texture;
@@ -241,6 +297,78 @@ TEST_CASE("[Texture]")
         REQUIRE(tgui::Texture("resources/image.png").isSmooth());
     }
 
+    SECTION("Pixel storage")
+    {
+        // Textures keep their pixels by default
+        REQUIRE(tgui::BackendTexture::getDefaultPixelStorage() == tgui::BackendTexture::PixelStorage::Full);
+        REQUIRE(tgui::Texture("resources/image.png").getData()->backendTexture->getPixels() != nullptr);
+
+        // Textures loaded from a file only keep which pixels are transparent when requested
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+        tgui::Texture textureFromFile{"resources/TransparentParts.png"};
+        REQUIRE(textureFromFile.getData()->backendTexture->getPixels() == nullptr);
+
+        // Textures without a filename keep their pixels so that they can still be saved
+        tgui::Vector2u imageSize;
+        const auto pixels = tgui::ImageLoader::loadFromFile("resources/TransparentParts.png", imageSize);
+        tgui::Texture textureFromPixels;
+        textureFromPixels.loadFromPixelData(imageSize, pixels.get());
+        REQUIRE(textureFromPixels.getData()->backendTexture->getPixels() != nullptr);
+        tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::Full);
+
+        unsigned int transparentPixels = 0;
+        unsigned int mismatchingPixels = 0;
+        for (unsigned int y = 0; y < imageSize.y; ++y)
+        {
+            for (unsigned int x = 0; x < imageSize.x; ++x)
+            {
+                if (textureFromFile.isTransparentPixel({x, y}))
+                    ++transparentPixels;
+                if (textureFromFile.isTransparentPixel({x, y}) != textureFromPixels.isTransparentPixel({x, y}))
+                    ++mismatchingPixels;
+            }
+        }
+        REQUIRE(transparentPixels > 0);
+        REQUIRE(mismatchingPixels == 0);
+
+        SECTION("Alpha mask threshold")
+        {
+            auto backendTexture = tgui::getBackend()->createTexture();
+            const std::uint8_t rgba[] = {0, 0, 0, 0,  0, 0, 0, 100,  0, 0, 0, 255};
+
+            auto copyPixels = [&rgba]{
+                auto pixelsCopy = tgui::MakeUniqueForOverwrite<std::uint8_t[]>(sizeof(rgba));
+                std::memcpy(pixelsCopy.get(), rgba, sizeof(rgba));
+                return pixelsCopy;
+            };
+
+            backendTexture->setPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+            REQUIRE(backendTexture->getAlphaMaskThreshold() == 0);
+            REQUIRE(backendTexture->load({3, 1}, copyPixels(), false));
+            REQUIRE(backendTexture->getPixels() == nullptr);
+            REQUIRE(backendTexture->isTransparentPixel({0, 0}));
+            REQUIRE(!backendTexture->isTransparentPixel({1, 0}));
+            REQUIRE(!backendTexture->isTransparentPixel({2, 0}));
+
+            // The threshold only applies to the texture on which it is set
+            auto otherBackendTexture = tgui::getBackend()->createTexture();
+            backendTexture->setAlphaMaskThreshold(100);
+            REQUIRE(backendTexture->getAlphaMaskThreshold() == 100);
+            REQUIRE(otherBackendTexture->getAlphaMaskThreshold() == 0);
+            REQUIRE(backendTexture->load({3, 1}, copyPixels(), false));
+            REQUIRE(backendTexture->isTransparentPixel({0, 0}));
+            REQUIRE(backendTexture->isTransparentPixel({1, 0}));
+            REQUIRE(!backendTexture->isTransparentPixel({2, 0}));
+
+            backendTexture->setPixelStorage(tgui::BackendTexture::PixelStorage::Full);
+            REQUIRE(backendTexture->load({3, 1}, copyPixels(), false));
+            REQUIRE(backendTexture->getPixels() != nullptr);
+            REQUIRE(backendTexture->isTransparentPixel({0, 0}));
+            REQUIRE(backendTexture->isTransparentPixel({1, 0}));
+            REQUIRE(!backendTexture->isTransparentPixel({2, 0}));
+        }
+    }
+
     SECTION("Color")
     {
         tgui::Texture texture{"resources/image.png"};
@@ -26,34 +26,111 @@
 
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/TextureManager.hpp>
+    #include <TGUI/Loading/ImageLoader.hpp>
 #endif
 
 TEST_CASE("[TextureManager]")
 {
-    tgui::Texture texture;
-    REQUIRE(tgui::TextureManager::getTexture(texture, "NonExistent.png", true) == nullptr);
-
-    tgui::Texture texture1;
-    tgui::Texture texture2;
-    tgui::Texture texture3;
-    std::shared_ptr<tgui::TextureData> textureData1 = tgui::TextureManager::getTexture(texture1, "resources/image.png", true);
-    std::shared_ptr<tgui::TextureData> textureData2 = tgui::TextureManager::getTexture(texture2, "resources/image.png", true);
-    std::shared_ptr<tgui::TextureData> textureData3 = tgui::TextureManager::getTexture(texture3, "resources/image.png", false);
-    REQUIRE(textureData1 != nullptr);
-    REQUIRE(textureData2 != nullptr);
-    REQUIRE(textureData3 != nullptr);
-    REQUIRE(textureData1 == textureData2);
-    REQUIRE(textureData1 != textureData3);
-
-    REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(nullptr), tgui::Exception);
-    REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
-    REQUIRE_NOTHROW(tgui::TextureManager::copyTexture(textureData1));
-
-    REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
-    REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
-
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+    SECTION("Loading and sharing")
+    {
+        tgui::Texture texture;
+        REQUIRE(tgui::TextureManager::getTexture(texture, "NonExistent.png", true) == nullptr);
+
+        tgui::Texture texture1;
+        tgui::Texture texture2;
+        tgui::Texture texture3;
+        std::shared_ptr<tgui::TextureData> textureData1 = tgui::TextureManager::getTexture(texture1, "resources/image.png", true);
+        std::shared_ptr<tgui::TextureData> textureData2 = tgui::TextureManager::getTexture(texture2, "resources/image.png", true);
+        std::shared_ptr<tgui::TextureData> textureData3 = tgui::TextureManager::getTexture(texture3, "resources/image.png", false);
+        REQUIRE(textureData1 != nullptr);
+        REQUIRE(textureData2 != nullptr);
+        REQUIRE(textureData3 != nullptr);
+        REQUIRE(textureData1 == textureData2);
+        REQUIRE(textureData1 != textureData3);
+
+        REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(nullptr), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
+        REQUIRE_NOTHROW(tgui::TextureManager::copyTexture(textureData1));
+
+        REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
+        REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+    }
+
+    SECTION("Atlas")
+    {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        REQUIRE(tgui::TextureManager::getAtlasPageSize() == 1024);
+        REQUIRE(tgui::TextureManager::getAtlasMaxImageSize() == 128);
+
+        tgui::TextureManager::setAtlasEnabled(true);
+        tgui::TextureManager::setAtlasPageSize(128);
+        tgui::TextureManager::setAtlasMaxImageSize(60);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+        REQUIRE(tgui::TextureManager::getAtlasPageSize() == 128);
+        REQUIRE(tgui::TextureManager::getAtlasMaxImageSize() == 60);
+        {
+            tgui::Texture texture1{"resources/TransparentParts.png"};
+            tgui::Texture texture2{"resources/TreeViewLeaf.png", {2, 3, 8, 7}};
+            tgui::Texture texture3{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+
+            // Small images share the same texture, without overlapping
+            const auto& data1 = texture1.getData();
+            const auto& data2 = texture2.getData();
+            const auto& data3 = texture3.getData();
+            REQUIRE(data1->backendTexture == data2->backendTexture);
+            REQUIRE(data1->backendTexture == data3->backendTexture);
+            REQUIRE(data1->backendTexture->getSize() == tgui::Vector2u(128, 128));
+            REQUIRE(data1->atlasRect.getSize() == tgui::Vector2u(50, 50));
+            REQUIRE(data2->atlasRect.getSize() == tgui::Vector2u(12, 13));
+            REQUIRE(data3->atlasRect.getSize() == tgui::Vector2u(50, 50));
+            REQUIRE(!data1->atlasRect.intersects(data2->atlasRect));
+            REQUIRE(!data1->atlasRect.intersects(data3->atlasRect));
+            REQUIRE(!data2->atlasRect.intersects(data3->atlasRect));
+
+            // The part rect remains relative to the image
+            REQUIRE(texture1.getPartRect() == tgui::UIntRect(0, 0, 50, 50));
+            REQUIRE(texture2.getPartRect() == tgui::UIntRect(2, 3, 8, 7));
+            REQUIRE(texture2.getImageSize() == tgui::Vector2u(8, 7));
+
+            // Transparent pixels are looked up inside the part of the page that contains the image
+            tgui::Vector2u imageSize;
+            const auto pixels = tgui::ImageLoader::loadFromFile("resources/TransparentParts.png", imageSize);
+            tgui::Texture textureWithoutAtlas;
+            textureWithoutAtlas.loadFromPixelData(imageSize, pixels.get());
+
+            unsigned int mismatchingPixels = 0;
+            for (unsigned int y = 0; y < imageSize.y; ++y)
+            {
+                for (unsigned int x = 0; x < imageSize.x; ++x)
+                {
+                    if (texture1.isTransparentPixel({x, y}) != textureWithoutAtlas.isTransparentPixel({x, y}))
+                        ++mismatchingPixels;
+                }
+            }
+            REQUIRE(mismatchingPixels == 0);
+
+            // Images that are too large get their own texture
+            tgui::Texture texture4{"resources/TextureRect1.png"};
+            REQUIRE(texture4.getData()->atlasRect == tgui::UIntRect{});
+            REQUIRE(texture4.getData()->backendTexture->getSize() == tgui::Vector2u(70, 40));
+            REQUIRE(texture4.getPartRect() == tgui::UIntRect(0, 0, 70, 40));
+
+            // Images without smoothing are placed on a different page
+            tgui::Texture texture5{"resources/TreeViewExpanded.png", {}, {}, false};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 2);
+            REQUIRE(texture5.getData()->backendTexture != data1->backendTexture);
+            REQUIRE(!texture5.getData()->backendTexture->isSmooth());
+        }
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        tgui::TextureManager::setAtlasEnabled(false);
+        tgui::TextureManager::setAtlasPageSize(1024);
+        tgui::TextureManager::setAtlasMaxImageSize(128);
+    }
 }
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+TEST_CASE("[Transform]")
+{
+    SECTION("transformPoint")
+    {
+        tgui::Transform transform;
+        REQUIRE(transform.transformPoint({3, 4}) == tgui::Vector2f(3, 4));
+
+        transform.translate({10, 20});
+        REQUIRE(transform.transformPoint({3, 4}) == tgui::Vector2f(13, 24));
+
+        transform.scale({2, 3});
+        REQUIRE(transform.transformPoint({3, 4}) == tgui::Vector2f(16, 32));
+    }
+
+    SECTION("getInverse")
+    {
+        tgui::Transform transform;
+        transform.translate({10.5f, -20.25f});
+        transform.rotate(30, {5, 7});
+        transform.scale({1.5f, 0.75f});
+
+        const tgui::Transform inverse = transform.getInverse();
+        const tgui::Vector2f point = inverse.transformPoint(transform.transformPoint({3, -4}));
+        REQUIRE(point.x == Approx(3));
+        REQUIRE(point.y == Approx(-4));
+
+        // A transform that can't be inverted results in an identity transform
+        tgui::Transform singularTransform;
+        singularTransform.scale({0, 2});
+        REQUIRE(singularTransform.getInverse().transformPoint({3, 4}) == tgui::Vector2f(3, 4));
+    }
+
+    SECTION("getMatrix")
+    {
+        tgui::Transform transform{2, 3, 4,
+                                  5, 6, 7,
+                                  0, 0, 1};
+        const std::array<float, 16> matrix = transform.getMatrix();
+        REQUIRE(matrix == std::array<float, 16>{2, 5, 0, 0,
+                                                3, 6, 0, 0,
+                                                0, 0, 1, 0,
+                                                4, 7, 0, 1});
+
+        // Constructing a transform from the 4x4 matrix gives back the same transform
+        REQUIRE(tgui::Transform{matrix}.getMatrix() == matrix);
+        REQUIRE((transform * tgui::Transform{}).getMatrix() == matrix);
+    }
+
+    SECTION("transformVertexPositions")
+    {
+        tgui::Transform transform;
+        transform.translate({10.5f, -20.25f});
+        transform.rotate(30, {5, 7});
+        transform.scale({1.5f, 0.75f});
+
+        // Use an odd amount of vertices so that both the vectorized and the scalar code paths are tested
+        std::vector<tgui::Vertex> vertices;
+        for (std::uint8_t i = 0; i < 7; ++i)
+        {
+            const float value = static_cast<float>(i);
+            vertices.push_back({{1.25f * value, 3.f - 2.5f * value}, {i, 2, 3, 4}, {0.1f * value, 0.2f}});
+        }
+
+        std::vector<tgui::Vertex> transformedVertices = vertices;
+        transform.transformVertexPositions(transformedVertices.data(), transformedVertices.size());
+
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            const tgui::Vector2f expectedPosition = transform.transformPoint(vertices[i].position);
+            REQUIRE(transformedVertices[i].position.x == Approx(expectedPosition.x));
+            REQUIRE(transformedVertices[i].position.y == Approx(expectedPosition.y));
+
+            // Only the position is changed
+            REQUIRE(transformedVertices[i].color.red == vertices[i].color.red);
+            REQUIRE(transformedVertices[i].texCoords == vertices[i].texCoords);
+        }
+    }
+}
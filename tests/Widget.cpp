@@ -305,6 +305,33 @@ TEST_CASE("[Widget]")
         REQUIRE(widget->getRotationOrigin() == tgui::Vector2f(0.8f, 0.7f));
     }
 
+    SECTION("Transform")
+    {
+        widget->setPosition(40, 30);
+        widget->setSize(100, 50);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(40, 30));
+        REQUIRE(widget->getInverseTransform().transformPoint({40, 30}) == tgui::Vector2f(0, 0));
+
+        // The cached transform is updated when the properties change
+        widget->setOrigin(0.5f, 0.5f);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(-10, 5));
+        widget->setScale(2);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(-60, -20));
+        widget->setSize(50, 100);
+        REQUIRE(widget->getTransform().transformPoint({0, 0}) == tgui::Vector2f(-10, -70));
+
+        widget->setRotation(90);
+        const tgui::Vector2f transformedPoint = widget->getTransform().transformPoint({0, 0});
+        REQUIRE(transformedPoint.x == Approx(140));
+        REQUIRE(transformedPoint.y == Approx(-20));
+
+        const tgui::Vector2f point = widget->getInverseTransform().transformPoint(widget->getTransform().transformPoint({20, 10}));
+        REQUIRE(point.x == Approx(20));
+        REQUIRE(point.y == Approx(10));
+
+        REQUIRE(widget->getAbsolutePosition() == widget->getTransform().transformPoint({0, 0}));
+    }
+
     SECTION("TextSize")
     {
         widget->setTextSize(15);
@@ -207,6 +207,20 @@ TEST_CASE("[ComboBox]")
         REQUIRE(!comboBox->contains("Item 1"));
         REQUIRE(!comboBox->containsId("1"));
     }
+
+    SECTION("Filter")
+    {
+        comboBox->addItem("Item 1");
+        comboBox->addItem("Item 2");
+        comboBox->addItem("Other");
+
+        comboBox->setFilter("item");
+        REQUIRE(comboBox->getFilter() == "item");
+        REQUIRE(comboBox->getItemCount() == 3);
+
+        comboBox->setFilter("");
+        REQUIRE(comboBox->getFilter() == "");
+    }
     
     SECTION("ItemsToDisplay")
     {
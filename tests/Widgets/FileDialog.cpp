@@ -28,6 +28,8 @@
     #include <TGUI/FileDialogIconLoader.hpp>
 #endif
 
+#include <thread>
+
 TEST_CASE("[FileDialog]")
 {
     tgui::FileDialog::Ptr dialog = tgui::FileDialog::create();
@@ -63,6 +65,42 @@ TEST_CASE("[FileDialog]")
         REQUIRE(dialog->getPath() == tgui::Filesystem::Path("/bin"));
     }
 
+    SECTION("Files are listed in the background")
+    {
+        auto container = tgui::Group::create();
+        container->add(dialog);
+
+        auto listView = dialog->get<tgui::ListView>("#TGUI_INTERNAL$ListView#");
+        const std::size_t fileCount = tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("resources")).size();
+        REQUIRE(fileCount > 0);
+
+        // Files are only added to the list view while the dialog is being updated
+        dialog->setPath("resources");
+        REQUIRE(listView->getItemCount() == 0);
+
+        for (unsigned int i = 0; (i < 5000) && (listView->getItemCount() < fileCount); ++i)
+        {
+            container->updateTime(std::chrono::milliseconds(1));
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(listView->getItemCount() == fileCount);
+        REQUIRE(listView->getItemRow(0) != listView->getItemRow(1));
+
+        // Navigating away while listing cancels the old listing
+        dialog->setPath("resources");
+        dialog->setPath(tgui::Filesystem::Path("/bin"));
+        REQUIRE(listView->getItemCount() == 0);
+
+        std::size_t chunkCount = 0;
+        std::size_t listedFiles = 0;
+        REQUIRE(!tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("resources"), 1, [&](std::vector<tgui::Filesystem::FileInfo>&& files){
+            listedFiles += files.size();
+            return ++chunkCount < 2;
+        }));
+        REQUIRE(chunkCount == 2);
+        REQUIRE(listedFiles == 2);
+    }
+
     SECTION("Filename")
     {
         REQUIRE(dialog->getFilename() == "");
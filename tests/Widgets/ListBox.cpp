@@ -250,6 +250,102 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Duplicate items and ids")
+    {
+        listBox->addItem("A", "1");
+        listBox->addItem("B", "2");
+        listBox->addItem("A", "3");
+        listBox->addItem("C", "2");
+
+        // Lookups find the first matching item
+        REQUIRE(listBox->getIndexById("2") == 1);
+        REQUIRE(listBox->setSelectedItem("A"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        REQUIRE(listBox->removeItemByIndex(0));
+        REQUIRE(listBox->getIndexById("3") == 1);
+        REQUIRE(listBox->setSelectedItem("A"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        REQUIRE(listBox->removeItemById("2"));
+        REQUIRE(listBox->getItemById("2") == "C");
+        REQUIRE(listBox->getIndexById("2") == 1);
+        REQUIRE(!listBox->containsId("1"));
+
+        REQUIRE(listBox->changeItemByIndex(0, "C"));
+        REQUIRE(!listBox->contains("A"));
+        REQUIRE(listBox->setSelectedItem("C"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+        REQUIRE(listBox->changeItem("C", "D"));
+        REQUIRE(listBox->getItems() == std::vector<tgui::String>{"D", "C"});
+        REQUIRE(listBox->setSelectedItem("C"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        listBox->setMaximumItems(1);
+        REQUIRE(!listBox->contains("C"));
+        REQUIRE(listBox->containsId("3"));
+    }
+
+    SECTION("Filter")
+    {
+        listBox->addItem("Apple pie");
+        listBox->addItem("Banana");
+        listBox->addItem("apple juice");
+        listBox->addItem("Cherry");
+        listBox->addItem("Pineapple");
+        REQUIRE(listBox->getFilter() == "");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4});
+
+        listBox->setFilter("app");
+        REQUIRE(listBox->getFilter() == "app");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{0, 2, 4});
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+        REQUIRE(listBox->getItemCount() == 5);
+
+        listBox->setFilter("APPLE");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{0, 2, 4});
+        listBox->setFilter("apple ");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{0, 2});
+        listBox->setFilter("an");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{1});
+        listBox->setFilter("xyz");
+        REQUIRE(listBox->getFilteredItemCount() == 0);
+
+        listBox->setFilter("apple");
+        listBox->addItem("Crab apple");
+        listBox->addItem("Grape");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{0, 2, 4, 5});
+
+        listBox->removeItemByIndex(0);
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{1, 3, 4});
+
+        listBox->changeItemByIndex(2, "Cherry apple");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{1, 2, 3, 4});
+        listBox->changeItemByIndex(3, "Pear");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{1, 2, 4});
+
+        // The index of 3-character sequences was updated for the changed and moved items
+        listBox->setFilter("pear");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{3});
+        listBox->setFilter("grape");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{5});
+        listBox->setFilter("pie");
+        REQUIRE(listBox->getFilteredItemCount() == 0);
+        listBox->setFilter("apple");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{1, 2, 4});
+
+        // Arrow keys skip the items that are filtered out
+        tgui::Event::KeyEvent downKeyEvent;
+        downKeyEvent.code = tgui::Event::KeyboardKey::Down;
+        listBox->setSelectedItemByIndex(2);
+        listBox->keyPressed(downKeyEvent);
+        REQUIRE(listBox->getSelectedItemIndex() == 4);
+
+        listBox->setFilter("");
+        REQUIRE(listBox->getFilteredItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4, 5});
+        REQUIRE(listBox->getFilteredItemCount() == listBox->getItemCount());
+    }
+
     SECTION("Data")
     {
         listBox->addItem("Item 1", "1");
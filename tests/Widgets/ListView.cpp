@@ -26,6 +26,29 @@
 
 #include "Tests.hpp"
 
+namespace
+{
+    struct RowsModel : public tgui::ListView::Model
+    {
+        std::size_t getRowCount() const override
+        {
+            return rows.size();
+        }
+
+        tgui::String getCell(std::size_t row, std::size_t column) const override
+        {
+            return (column < rows[row].size()) ? rows[row][column] : "";
+        }
+
+        tgui::Any getRowData(std::size_t row) const override
+        {
+            return row * 10;
+        }
+
+        std::vector<std::vector<tgui::String>> rows;
+    };
+}
+
 TEST_CASE("[ListView]")
 {
     tgui::ListView::Ptr listView = tgui::ListView::create();
@@ -250,6 +273,113 @@ TEST_CASE("[ListView]")
 
         listView->sort(2, cmp2);
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
+
+        listView->sortNumerically(0);
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"300", "", ""}, {"1000", "7", ""}});
+
+        listView->sortNumerically(1, false);
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"1000", "7", ""}, {"200", "-5", "20"}, {"300", "", ""}});
+
+        const std::vector<double> keys = {2, 1, 2};
+        listView->sortByKey([&keys](std::size_t index){ return keys[index]; });
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
+
+        listView->sortByKey([&keys](std::size_t index){ return keys[index]; }, false);
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"300", "", ""}, {"1000", "7", ""}});
+    }
+
+    SECTION("Batch updates")
+    {
+        listView->addColumn("");
+        listView->setColumnAutoResize(0, true);
+        listView->addItem("Short");
+        listView->addItem("Very very long item");
+        listView->setSelectedItem(1);
+
+        unsigned int selectCount = 0;
+        listView->onItemSelect([&]{ ++selectCount; });
+
+        const float columnWidth = listView->getColumnWidth(0);
+
+        listView->beginUpdate();
+        listView->beginUpdate();
+        listView->changeItem(0, {"Medium item"});
+        listView->removeItem(1);
+        for (unsigned int i = 0; i < 100; ++i)
+            listView->addItem("Item");
+        listView->endUpdate();
+
+        // Nothing is updated until the outer endUpdate call
+        REQUIRE(listView->getColumnWidth(0) == columnWidth);
+        REQUIRE(selectCount == 0);
+        REQUIRE(listView->getItemCount() == 101);
+
+        listView->endUpdate();
+        REQUIRE(listView->getColumnWidth(0) < columnWidth);
+        REQUIRE(selectCount == 1);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        REQUIRE(listView->getVerticalScrollbarValue() > 0); // Auto-scrolled to the bottom
+
+        // Calling endUpdate too many times has no effect
+        listView->endUpdate();
+        listView->removeItem(0);
+        REQUIRE(listView->getColumnWidth(0) > 0);
+    }
+
+    SECTION("Model")
+    {
+        listView->addColumn("C1");
+        listView->addColumn("C2");
+        listView->addItem({"1", "2"});
+        listView->setSelectedItem(0);
+        REQUIRE(listView->getModel() == nullptr);
+
+        auto model = std::make_shared<RowsModel>();
+        model->rows = {{"a", "A"}, {"b", "B"}, {"c", "C"}, {"d", "D"}};
+        listView->setModel(model);
+        REQUIRE(listView->getModel() == model);
+        REQUIRE(listView->getItemCount() == 4);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        REQUIRE(listView->getItem(1) == "b");
+        REQUIRE(listView->getItemCell(2, 1) == "C");
+        REQUIRE(listView->getItemRow(3) == std::vector<tgui::String>{"d", "D"});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"a", "b", "c", "d"});
+        REQUIRE(listView->getItemRows().size() == 4);
+        REQUIRE(listView->getItemData<std::size_t>(2) == 20);
+
+        // Items can't be added to the list view itself
+        listView->addItem("x");
+        REQUIRE(listView->getItemCount() == 4);
+
+        unsigned int selectCount = 0;
+        listView->onItemSelect([&]{ ++selectCount; });
+
+        listView->setMultiSelect(true);
+        listView->setSelectedItems({1, 3});
+        selectCount = 0;
+
+        model->rows.insert(model->rows.begin(), {"z", "Z"});
+        listView->modelRowsInserted(0, 1);
+        REQUIRE(listView->getItemCount() == 5);
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{2, 4});
+
+        model->rows.erase(model->rows.begin() + 1, model->rows.begin() + 3);
+        listView->modelRowsRemoved(1, 2);
+        REQUIRE(listView->getItemCount() == 3);
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{2});
+        REQUIRE(selectCount == 1);
+
+        model->rows[2][0] = "changed";
+        listView->modelRowsChanged(2, 1);
+        REQUIRE(listView->getItem(2) == "changed");
+
+        listView->modelReset();
+        REQUIRE(listView->getSelectedItemIndices().empty());
+
+        listView->setModel(nullptr);
+        REQUIRE(listView->getItemCount() == 0);
+        listView->addItem("x");
+        REQUIRE(listView->getItemCount() == 1);
     }
 
     SECTION("Returned item rows depend on columns")
@@ -1200,6 +1330,15 @@ TEST_CASE("[ListView]")
             }
         }
 
+        SECTION("Model")
+        {
+            auto model = std::make_shared<RowsModel>();
+            model->rows = listView->getItemRows();
+            listView->setModel(model);
+            listView->setSelectedItem(4);
+            TEST_DRAW("ListView_SelectedNoHover.png")
+        }
+
         SECTION("Selected item")
         {
             listView->setSelectedItem(4);
@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 
+#include <atomic>
+#include <future>
+
 TEST_CASE("[TreeView]")
 {
     auto treeView = tgui::TreeView::create();
@@ -226,6 +229,227 @@ TEST_CASE("[TreeView]")
         REQUIRE(treeView->getSelectedItem().empty());
     }
 
+    SECTION("Item handles")
+    {
+        auto vehicles = treeView->addChildItem({}, "Vehicles");
+        auto parts = treeView->addChildItem(vehicles, "Parts");
+        auto wheel = treeView->addChildItem(parts, "Wheel");
+        treeView->addItem({"Vehicles", "Parts", "Engine"});
+        REQUIRE(vehicles.isValid());
+        REQUIRE(wheel.isValid());
+        REQUIRE(!tgui::TreeView::ItemHandle().isValid());
+
+        REQUIRE(treeView->getNodes().size() == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 2);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes[0].text == "Wheel");
+
+        REQUIRE(treeView->getItemHandle({"Vehicles", "Parts"}).isValid());
+        REQUIRE(!treeView->getItemHandle({"Vehicles", "Wheel"}).isValid());
+
+        treeView->collapse(parts);
+        REQUIRE(!treeView->getNodes()[0].nodes[0].expanded);
+        treeView->collapse(vehicles);
+        treeView->expand(wheel);
+        REQUIRE(treeView->getNodes()[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes[0].expanded);
+
+        treeView->collapseAll();
+        REQUIRE(treeView->selectItem(wheel));
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Vehicles", "Parts", "Wheel"});
+        REQUIRE(treeView->getSelectedItemHandle().isValid());
+
+        auto engine = treeView->getItemHandle({"Vehicles", "Parts", "Engine"});
+        REQUIRE(treeView->removeItem(wheel));
+        REQUIRE(!wheel.isValid());
+        REQUIRE(!treeView->removeItem(wheel));
+        REQUIRE(!treeView->addChildItem(wheel, "Bolt").isValid());
+        REQUIRE(!treeView->selectItem(wheel));
+
+        // Removing the last child also removes the empty parents by default
+        REQUIRE(treeView->removeItem(engine));
+        REQUIRE(!parts.isValid());
+        REQUIRE(!vehicles.isValid());
+        REQUIRE(treeView->getNodes().empty());
+    }
+
+    SECTION("Item handles of other tree views")
+    {
+        auto otherTreeView = tgui::TreeView::create();
+        auto otherRoot = otherTreeView->addChildItem({}, "Root");
+        auto otherChild = otherTreeView->addChildItem(otherRoot, "Child");
+        treeView->addItem({"Root", "Child"});
+
+        // Handles are rejected by a tree view that doesn't contain the item
+        REQUIRE(!treeView->removeItem(otherChild));
+        REQUIRE(!treeView->removeItem(otherRoot));
+        REQUIRE(!treeView->selectItem(otherChild));
+        REQUIRE(!treeView->addChildItem(otherRoot, "New").isValid());
+        REQUIRE(otherTreeView->getNodes()[0].nodes.size() == 1);
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+
+        // A copied tree view has its own items
+        auto copiedTreeView = tgui::TreeView::copy(otherTreeView);
+        REQUIRE(!copiedTreeView->removeItem(otherChild));
+        REQUIRE(otherTreeView->removeItem(otherChild));
+        REQUIRE(copiedTreeView->getNodes()[0].nodes.size() == 1);
+    }
+
+    SECTION("Items with the same text")
+    {
+        treeView->addItem({"Parent", "Child"});
+        treeView->addItem({"Parent", "Child"});
+        treeView->addItem({"Parent", "Child", "Leaf"});
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 2);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[1].nodes.empty());
+
+        // The first item with the text is removed, after which lookups find the second one
+        REQUIRE(treeView->removeItem({"Parent", "Child"}, false));
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.empty());
+
+        treeView->addItem({"Parent", "Child", "Leaf"});
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 1);
+
+        REQUIRE(treeView->removeItem({"Parent", "Child", "Leaf"}));
+        REQUIRE(treeView->getNodes().empty());
+    }
+
+    SECTION("Lazy loading")
+    {
+        std::vector<std::vector<tgui::String>> requestedHierarchies;
+        const auto loader = [&requestedHierarchies](const std::vector<tgui::String>& hierarchy) {
+            requestedHierarchies.push_back(hierarchy);
+            return std::vector<tgui::TreeView::LoadedChild>{{"Dir", true}, {"File", false}};
+        };
+
+        REQUIRE(treeView->getLoadingItemText() == "Loading...");
+        treeView->setLoadingItemText("Please wait");
+        REQUIRE(treeView->getLoadingItemText() == "Please wait");
+
+        SECTION("On gui thread")
+        {
+            treeView->setChildLoader(loader);
+            treeView->addLazyChildItem({}, "Root");
+            REQUIRE(treeView->getNodes().size() == 1);
+            REQUIRE(!treeView->getNodes()[0].expanded);
+            REQUIRE(treeView->getNodes()[0].nodes.empty());
+
+            // Expanding everything doesn't load lazy items
+            treeView->expandAll();
+            REQUIRE(requestedHierarchies.empty());
+
+            treeView->expand({"Root"});
+            REQUIRE(requestedHierarchies == std::vector<std::vector<tgui::String>>{{"Root"}});
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 2);
+            REQUIRE(!treeView->getNodes()[0].nodes[0].expanded);
+
+            // Children are only loaded once
+            treeView->collapse({"Root"});
+            treeView->expand({"Root"});
+            REQUIRE(requestedHierarchies.size() == 1);
+
+            // Selecting an item expands its parents, which loads them
+            treeView->addItem({"Root", "Dir", "Extra"});
+            REQUIRE(requestedHierarchies.size() == 1);
+            treeView->collapseAll();
+            REQUIRE(treeView->selectItem({"Root", "Dir", "Extra"}));
+            REQUIRE(requestedHierarchies.size() == 2);
+            REQUIRE(requestedHierarchies[1] == std::vector<tgui::String>{"Root", "Dir"});
+            REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 3);
+            REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Root", "Dir", "Extra"});
+        }
+
+        SECTION("In background")
+        {
+            treeView->setChildLoader([](const std::vector<tgui::String>&) {
+                return std::vector<tgui::TreeView::LoadedChild>{{"A"}, {"B"}};
+            }, true);
+            auto root = treeView->addLazyChildItem({}, "Root");
+            treeView->expand(root);
+
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeView->getNodes()[0].nodes[0].text == "Please wait");
+
+            treeView->waitForChildLoads();
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 2);
+            REQUIRE(treeView->getNodes()[0].nodes[0].text == "A");
+            REQUIRE(treeView->getNodes()[0].nodes[1].text == "B");
+        }
+
+        SECTION("In background with failing loader")
+        {
+            auto container = tgui::Group::create();
+            container->add(treeView);
+
+            std::atomic<unsigned int> attempts{0};
+            treeView->setChildLoader([&attempts](const std::vector<tgui::String>&) {
+                if (attempts++ == 0)
+                    throw std::runtime_error("Failed to load children");
+                return std::vector<tgui::TreeView::LoadedChild>{{"A"}};
+            }, true);
+            treeView->addLazyChildItem({}, "Root");
+            treeView->expand({"Root"});
+
+            // The exception is not propagated and the placeholder remains
+            REQUIRE_NOTHROW(treeView->waitForChildLoads());
+            REQUIRE_NOTHROW(container->updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(attempts == 1);
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeView->getNodes()[0].nodes[0].text == "Please wait");
+
+            // Expanding the node again retries the load and reuses the placeholder
+            treeView->collapse({"Root"});
+            treeView->expand({"Root"});
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+            treeView->waitForChildLoads();
+            REQUIRE(attempts == 2);
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeView->getNodes()[0].nodes[0].text == "A");
+        }
+
+        SECTION("In background while copying")
+        {
+            std::promise<void> finishLoadingPromise;
+            const std::shared_future<void> finishLoading = finishLoadingPromise.get_future().share();
+            treeView->setChildLoader([finishLoading](const std::vector<tgui::String>&) {
+                finishLoading.wait();
+                return std::vector<tgui::TreeView::LoadedChild>{{"A"}};
+            }, true);
+            treeView->addLazyChildItem({}, "Root");
+            treeView->expand({"Root"});
+
+            auto treeViewCopy = tgui::TreeView::copy(treeView);
+            REQUIRE(treeViewCopy->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeViewCopy->getNodes()[0].nodes[0].text == "Please wait");
+            finishLoadingPromise.set_value();
+
+            treeView->waitForChildLoads();
+            treeViewCopy->waitForChildLoads();
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeView->getNodes()[0].nodes[0].text == "A");
+            REQUIRE(treeViewCopy->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeViewCopy->getNodes()[0].nodes[0].text == "A");
+        }
+    }
+
+    SECTION("Expanding and collapsing keeps selection")
+    {
+        treeView->addItem({"One", "Sub1"});
+        treeView->addItem({"One", "Sub2"});
+        treeView->addItem({"Two", "Sub"});
+
+        REQUIRE(treeView->selectItem({"Two", "Sub"}));
+        treeView->collapse({"One"});
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Two", "Sub"});
+        treeView->expand({"One"});
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Two", "Sub"});
+
+        // A selected item that becomes hidden is no longer selected
+        treeView->collapse({"Two"});
+        REQUIRE(treeView->getSelectedItem().empty());
+    }
+
     SECTION("ItemHeight")
     {
         treeView->setItemHeight(30);